@@ -561,6 +561,7 @@ struct CV_EXPORTS_W_SIMPLE UsacParams
     CV_WRAP UsacParams();
     CV_PROP_RW double confidence;
     CV_PROP_RW bool isParallel;
+    CV_PROP_RW bool isParallelDeterministic; //!< parallel batched evaluation, result does not depend on number of threads
     CV_PROP_RW int loIterations;
     CV_PROP_RW LocalOptimMethod loMethod;
     CV_PROP_RW int loSampleSize;
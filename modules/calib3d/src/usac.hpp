@@ -873,6 +873,8 @@ public:
     // getters
     virtual int getSampleSize () const = 0;
     virtual bool isParallel() const = 0;
+    virtual bool isParallelDeterministic() const = 0;
+    virtual int getParallelBatchSize () const = 0;
     virtual PolishingMethod getFinalPolisher () const = 0;
     virtual LocalOptimMethod getLO () const = 0;
     virtual ErrorMetric getError () const = 0;
@@ -924,6 +926,7 @@ public:
     virtual void setNeighborsType (NeighborSearchMethod neighbors) = 0;
     virtual void setCellSize (int cell_size_) = 0;
     virtual void setParallel (bool is_parallel) = 0;
+    virtual void setParallelDeterministic (bool is_deterministic) = 0;
     virtual void setVerifier (VerificationMethod verifier_) = 0;
     virtual void setPolisher (PolishingMethod polisher_) = 0;
     virtual void setError (ErrorMetric error_) = 0;
@@ -4,6 +4,7 @@
 
 #include "../precomp.hpp"
 #include "../usac.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 
 namespace cv { namespace usac {
 int Quality::getInliers(const Ptr<Error> &error, const Mat &model, std::vector<int> &inliers, double threshold) {
@@ -73,9 +74,19 @@ public:
     }
 
     Score getScore (const std::vector<float> &errors) const override {
-        int inlier_number = 0;
-        for (int point = 0; point < points_size; point++)
-            if (errors[point] < threshold)
+        const float * const errs = errors.data();
+        int inlier_number = 0, point = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_thr = vx_setall_f32((float)threshold);
+        v_int32 v_inliers = vx_setzero_s32();
+        // comparison mask is all ones (-1) for inliers
+        for (; point <= points_size - vlanes; point += vlanes)
+            v_inliers = v_sub(v_inliers, v_reinterpret_as_s32(v_lt(vx_load(errs + point), v_thr)));
+        inlier_number = v_reduce_sum(v_inliers);
+#endif
+        for (; point < points_size; point++)
+            if (errs[point] < threshold)
                 inlier_number++;
         // score is negative inlier number! If less then better
         return {inlier_number, -static_cast<float>(inlier_number)};
@@ -132,10 +143,25 @@ public:
     }
 
     Score getScore (const std::vector<float> &errors) const override {
+        const float * const errs = errors.data();
         float sum_errors = 0;
-        int inlier_number = 0;
-        for (int point = 0; point < points_size; point++) {
-            const auto err = errors[point];
+        int inlier_number = 0, point = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        const int vlanes = VTraits<v_float32>::vlanes();
+        const v_float32 v_thr = vx_setall_f32((float)threshold), v_norm_thr = vx_setall_f32(norm_thr),
+                v_one_over_thr = vx_setall_f32(one_over_thr), v_one = vx_setall_f32(1.f), v_zero = vx_setzero_f32();
+        v_float32 v_sum = vx_setzero_f32();
+        v_int32 v_inliers = vx_setzero_s32();
+        for (; point <= points_size - vlanes; point += vlanes) {
+            const v_float32 err = vx_load(errs + point);
+            v_sum = v_add(v_sum, v_select(v_lt(err, v_norm_thr), v_sub(v_one, v_mul(err, v_one_over_thr)), v_zero));
+            v_inliers = v_sub(v_inliers, v_reinterpret_as_s32(v_lt(err, v_thr)));
+        }
+        sum_errors = -v_reduce_sum(v_sum);
+        inlier_number = v_reduce_sum(v_inliers);
+#endif
+        for (; point < points_size; point++) {
+            const auto err = errs[point];
             if (err < norm_thr) {
                 sum_errors -= (1 - err * one_over_thr);
                 if (err < threshold)
@@ -10,6 +10,7 @@ namespace cv {
 UsacParams::UsacParams() {
     confidence=0.99;
     isParallel=false;
+    isParallelDeterministic=false;
     loIterations=5;
     loMethod=LOCAL_OPTIM_INNER_LO;
     loSampleSize=14;
@@ -127,7 +128,15 @@ public:
 
     int points_size, _state, filtered_points_size;
     double threshold, max_thr;
-    bool parallel;
+    bool parallel, batched;
+
+    // per-lane estimator and quality used to evaluate a batch of hypotheses in deterministic parallel mode
+    struct BatchLane {
+        Ptr<Estimator> estimator;
+        Ptr<Quality> quality;
+        std::vector<Mat> models;
+    };
+    std::vector<BatchLane> lanes;
 
     Matx33d T1, T2;
     Mat points, K1, K2, calib_points, image_points, norm_points, filtered_points;
@@ -139,7 +148,8 @@ public:
         _state = params->getRandomGeneratorState();
         threshold = params->getThreshold();
         max_thr = std::max(threshold, params->getMaximumThreshold());
-        parallel = params->isParallel();
+        batched = params->isParallelDeterministic();
+        parallel = params->isParallel() && !batched;
         Mat undist_points1, undist_points2;
         if (params->isPnP()) {
             if (! K1_.empty()) {
@@ -416,7 +426,7 @@ public:
         }
 
         // if normal ransac or parallel call, avoid redundant init
-        if ((! params->isParallel() || parallel_call) && params->getLO() != LocalOptimMethod::LOCAL_OPTIM_NULL) {
+        if ((! parallel || parallel_call) && params->getLO() != LocalOptimMethod::LOCAL_OPTIM_NULL) {
             lo_sampler = UniformRandomGenerator::create(state, points_size, params->getLOSampleSize());
             const auto lo_termination = StandardTerminationCriteria::create(params->getConfidence(), points_size, min_sample_size, params->getMaxIters());
             switch (params->getLO()) {
@@ -638,6 +648,48 @@ public:
             std::vector<Mat> models(_estimator->getMaxNumSolutions());
             std::vector<int> sample(_estimator->getMinimalSampleSize()), supports;
             supports.reserve(3*MAX_MODELS_ADAPT); // store model supports during adaption
+
+            // Deterministic parallel mode: samples of a batch are drawn sequentially by the main sampler,
+            // models are estimated and scored in parallel by a fixed number of lanes (independent of
+            // the number of threads), and the hypotheses are then processed below in sampling order.
+            const int batch_size = batched ? params->getParallelBatchSize() : 0;
+            std::vector<std::vector<int>> batch_samples(batch_size, std::vector<int>(sample.size()));
+            std::vector<std::vector<Mat>> batch_models(batch_size, std::vector<Mat>(models.size()));
+            std::vector<std::vector<Score>> batch_scores(batch_size, std::vector<Score>(models.size()));
+            std::vector<int> batch_num_models(batch_size);
+            int batch_filled = 0, batch_pos = 0;
+            if (batched && lanes.empty()) {
+                lanes.resize(std::min(16, batch_size));
+                for (auto &lane : lanes) {
+                    Ptr<MinimalSolver> min_solver; Ptr<NonMinimalSolver> non_min_solver; Ptr<Error> error;
+                    Ptr<Degeneracy> degeneracy; Ptr<ModelVerifier> verifier; Ptr<LocalOptimization> lo;
+                    Ptr<Termination> termination; Ptr<Sampler> sampler; Ptr<RandomGenerator> lo_sampler;
+                    Ptr<WeightFunction> weight_fnc;
+                    initialize (_state, min_solver, non_min_solver, error, lane.estimator, degeneracy, lane.quality,
+                            verifier, lo, termination, sampler, lo_sampler, weight_fnc, true);
+                    lane.models = std::vector<Mat>(models.size());
+                }
+            }
+            auto evaluate_batch = [&] () {
+                batch_filled = std::min(batch_size, max_iters - iters);
+                batch_pos = 0;
+                for (int b = 0; b < batch_filled; b++)
+                    _sampler->generateSample(batch_samples[b]);
+                const int num_lanes = (int)lanes.size();
+                parallel_for_(Range(0, num_lanes), [&](const Range &range) {
+                    for (int l = range.start; l < range.end; l++) {
+                        BatchLane &lane = lanes[l];
+                        for (int b = l * batch_filled / num_lanes; b < (l+1) * batch_filled / num_lanes; b++) {
+                            const int num_models = lane.estimator->estimateModels(batch_samples[b], lane.models);
+                            for (int i = 0; i < num_models; i++) {
+                                lane.models[i].copyTo(batch_models[b][i]);
+                                batch_scores[b][i] = lane.quality->getScore(lane.quality->getErrorFnc()->getErrors(lane.models[i]));
+                            }
+                            batch_num_models[b] = num_models;
+                        }
+                    }
+                }, num_lanes);
+            };
             auto update_best = [&] (const Mat &new_model, const Score &new_score, bool from_lo=false) {
                 _quality->getInliers(new_model, model_inliers_mask);
                 IoU = Utils::intersectionOverUnion(best_inliers_mask, model_inliers_mask);
@@ -679,24 +731,33 @@ public:
             };
 
             for (; iters < max_iters; iters++) {
-                _sampler->generateSample(sample);
-                int number_of_models;
-                if (adapt) {
+                int number_of_models, batch_idx = -1;
+                if (batched) {
+                    if (batch_pos == batch_filled)
+                        evaluate_batch();
+                    batch_idx = batch_pos++;
+                    sample = batch_samples[batch_idx];
+                    std::swap(models, batch_models[batch_idx]);
+                    number_of_models = batch_num_models[batch_idx];
+                } else {
+                    _sampler->generateSample(sample);
                     number_of_models = _estimator->estimateModels(sample, models);
+                }
+                if (adapt) {
                     mean_num_est_models += number_of_models;
                     num_estimations++;
-                } else {
-                    number_of_models = _estimator->estimateModels(sample, models);
                 }
                 for (int i = 0; i < number_of_models; i++) {
                     num_total_tested_models++;
                     if (adapt) {
-                        current_score = _quality->getScore(models[i]);
+                        current_score = batched ? batch_scores[batch_idx][i] : _quality->getScore(models[i]);
                         supports.emplace_back(current_score.inlier_number);
                         if (IS_NON_RAND_TEST && best_score_sample.isBetter(current_score)) {
                             models_for_random_test.emplace_back(models[i].clone());
                             samples_for_random_test.emplace_back(sample);
                         }
+                    } else if (batched) {
+                        current_score = batch_scores[batch_idx][i];
                     } else {
                         if (! _model_verifier->isModelGood(models[i], current_score))
                             continue;
@@ -1076,6 +1137,7 @@ void setParameters (Ptr<Model> &params, EstimationMethod estimator, const UsacPa
     params->setLOSampleSize(usac_params.loSampleSize);
     params->setLOIterations(usac_params.loIterations);
     params->setParallel(usac_params.isParallel);
+    params->setParallelDeterministic(usac_params.isParallelDeterministic);
     params->setNeighborsType(usac_params.neighborsSearch);
     params->setRandomGeneratorState(usac_params.randomGeneratorState);
     params->maskRequired(mask_needed);
@@ -1293,11 +1355,15 @@ private:
 
     bool need_mask = true, // do we need inlier mask in the end
         is_parallel = false, // use parallel RANSAC
+        is_parallel_deterministic = false, // evaluate hypotheses in parallel batches, reproducible for fixed seed
         is_nonrand_test = false; // is test for the final model non-randomness
 
     // state of pseudo-random number generator
     int random_generator_state = 0;
 
+    // number of hypotheses generated and evaluated together in deterministic parallel mode
+    int parallel_batch_size = 64;
+
     // number of iterations of plane-and-parallax in DEGENSAC^+
     int plane_and_parallax_max_iters = 300;
 
@@ -1354,6 +1420,7 @@ public:
     void setVerifier (VerificationMethod verifier_) override { verifier = verifier_; }
     void setPolisher (PolishingMethod polisher_) override { polisher = polisher_; }
     void setParallel (bool is_parallel_) override { is_parallel = is_parallel_; }
+    void setParallelDeterministic (bool is_deterministic_) override { is_parallel_deterministic = is_deterministic_; }
     void setError (ErrorMetric error_) override { est_error = error_; }
     void setLocalOptimization (LocalOptimMethod lo_) override { lo = lo_; }
     void setKNearestNeighhbors (int knn_) override { k_nearest_neighbors = knn_; }
@@ -1416,6 +1483,8 @@ public:
     const std::vector<int> &getGridCellNumber () const override { return grid_cell_number; }
     bool isLarssonOptimization () const override { return is_larsson_optimization; }
     bool isParallel () const override { return is_parallel; }
+    bool isParallelDeterministic () const override { return is_parallel_deterministic; }
+    int getParallelBatchSize () const override { return parallel_batch_size; }
     bool isFundamental () const override {
         return estimator == EstimationMethod::FUNDAMENTAL ||
                estimator == EstimationMethod::FUNDAMENTAL8;
@@ -484,6 +484,32 @@ TEST(usac_testUsacParams, accuracy) {
     checkInliersMask(TestSolver::Homogr, inl_size, usac_params.threshold, pts1, pts2, model, mask);
 }
 
+TEST(usac_testUsacParams, parallel_deterministic) {
+    std::vector<int> gt_inliers;
+    const int pts_size = 5000;
+    cv::RNG rng(12345);
+    cv::UsacParams usac_params;
+    usac_params.isParallelDeterministic = true;
+    usac_params.threshold = 2.;
+    cv::Mat pts1, pts2, K1, K2;
+    const int inl_size = generatePoints(rng, pts1, pts2, K1, K2, false, pts_size, TestSolver::Homogr,
+            0.3 /*inl ratio*/, 0.1 /*noise std*/, gt_inliers);
+    const int num_threads = cv::getNumThreads();
+    std::vector<cv::Mat> models, masks;
+    for (int threads : {1, 3, 8}) {
+        cv::setNumThreads(threads);
+        cv::Mat mask, H = cv::findHomography(pts1, pts2, mask, usac_params);
+        checkInliersMask(TestSolver::Homogr, inl_size, usac_params.threshold, pts1, pts2, H, mask);
+        models.emplace_back(H);
+        masks.emplace_back(mask);
+    }
+    cv::setNumThreads(num_threads);
+    for (size_t i = 1; i < models.size(); i++) {
+        EXPECT_EQ(0, cvtest::norm(models[0], models[i], NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(masks[0], masks[i], NORM_INF));
+    }
+}
+
 TEST(usac_solvePnPRansac, regression_21105) {
     std::vector<int> gt_inliers;
     const int pts_size = 100;
@@ -3565,6 +3565,13 @@ real-valued scalar ( double )):
 @note Comma-separated initializers and probably some other operations may require additional
 explicit Mat() or Mat_<T>() constructor calls to resolve a possible ambiguity.
 
+Chains of the element-wise operations (addition, subtraction, scaling, per-element multiplication
+and division, minimum, maximum, absolute value and a final comparison) over floating-point
+matrices (CV_32F, CV_64F) of up to 4 channels and of up to 2 distinct matrix operands are evaluated
+in a single parallel pass on assignment, without the intermediate temporary matrices, e.g.
+`abs(A - B) > alpha` or `(A - B).mul(A + B)*alpha + s`. Other expressions are evaluated operation
+by operation.
+
 Here are examples of matrix expressions:
 @code
     // compute pseudo-inverse of A, equivalent to A.inv(DECOMP_SVD)
@@ -3683,6 +3690,11 @@ MatExpr operator / (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) / b;
 CV_EXPORTS MatExpr operator < (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator < (const Mat& a, double s);
 CV_EXPORTS MatExpr operator < (double s, const Mat& a);
+CV_EXPORTS MatExpr operator < (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator < (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator < (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator < (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator < (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator < (const Mat& a, const Matx<_Tp, m, n>& b) { return a < Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3691,6 +3703,11 @@ MatExpr operator < (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) < b;
 CV_EXPORTS MatExpr operator <= (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator <= (const Mat& a, double s);
 CV_EXPORTS MatExpr operator <= (double s, const Mat& a);
+CV_EXPORTS MatExpr operator <= (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator <= (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator <= (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator <= (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator <= (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator <= (const Mat& a, const Matx<_Tp, m, n>& b) { return a <= Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3699,6 +3716,11 @@ MatExpr operator <= (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) <=
 CV_EXPORTS MatExpr operator == (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator == (const Mat& a, double s);
 CV_EXPORTS MatExpr operator == (double s, const Mat& a);
+CV_EXPORTS MatExpr operator == (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator == (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator == (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator == (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator == (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator == (const Mat& a, const Matx<_Tp, m, n>& b) { return a == Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3707,6 +3729,11 @@ MatExpr operator == (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) ==
 CV_EXPORTS MatExpr operator != (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator != (const Mat& a, double s);
 CV_EXPORTS MatExpr operator != (double s, const Mat& a);
+CV_EXPORTS MatExpr operator != (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator != (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator != (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator != (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator != (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator != (const Mat& a, const Matx<_Tp, m, n>& b) { return a != Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3715,6 +3742,11 @@ MatExpr operator != (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) !=
 CV_EXPORTS MatExpr operator >= (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator >= (const Mat& a, double s);
 CV_EXPORTS MatExpr operator >= (double s, const Mat& a);
+CV_EXPORTS MatExpr operator >= (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator >= (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator >= (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator >= (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator >= (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator >= (const Mat& a, const Matx<_Tp, m, n>& b) { return a >= Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3723,6 +3755,11 @@ MatExpr operator >= (const Matx<_Tp, m, n>& a, const Mat& b) { return Mat(a) >=
 CV_EXPORTS MatExpr operator > (const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr operator > (const Mat& a, double s);
 CV_EXPORTS MatExpr operator > (double s, const Mat& a);
+CV_EXPORTS MatExpr operator > (const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr operator > (const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr operator > (const MatExpr& e, double s);
+CV_EXPORTS MatExpr operator > (double s, const MatExpr& e);
+CV_EXPORTS MatExpr operator > (const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr operator > (const Mat& a, const Matx<_Tp, m, n>& b) { return a > Mat(b); }
 template<typename _Tp, int m, int n> static inline
@@ -3757,6 +3794,11 @@ CV_EXPORTS MatExpr operator ~(const Mat& m);
 CV_EXPORTS MatExpr min(const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr min(const Mat& a, double s);
 CV_EXPORTS MatExpr min(double s, const Mat& a);
+CV_EXPORTS MatExpr min(const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr min(const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr min(const MatExpr& e, double s);
+CV_EXPORTS MatExpr min(double s, const MatExpr& e);
+CV_EXPORTS MatExpr min(const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr min (const Mat& a, const Matx<_Tp, m, n>& b) { return min(a, Mat(b)); }
 template<typename _Tp, int m, int n> static inline
@@ -3765,6 +3807,11 @@ MatExpr min (const Matx<_Tp, m, n>& a, const Mat& b) { return min(Mat(a), b); }
 CV_EXPORTS MatExpr max(const Mat& a, const Mat& b);
 CV_EXPORTS MatExpr max(const Mat& a, double s);
 CV_EXPORTS MatExpr max(double s, const Mat& a);
+CV_EXPORTS MatExpr max(const MatExpr& e, const Mat& m);
+CV_EXPORTS MatExpr max(const Mat& m, const MatExpr& e);
+CV_EXPORTS MatExpr max(const MatExpr& e, double s);
+CV_EXPORTS MatExpr max(double s, const MatExpr& e);
+CV_EXPORTS MatExpr max(const MatExpr& e1, const MatExpr& e2);
 template<typename _Tp, int m, int n> static inline
 MatExpr max (const Mat& a, const Matx<_Tp, m, n>& b) { return max(a, Mat(b)); }
 template<typename _Tp, int m, int n> static inline
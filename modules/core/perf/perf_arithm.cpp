@@ -452,6 +452,103 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/ , BinaryOpTest,
     )
 );
 
+///////////// Element-wise operations on large arrays ////////////////////////
+// Memory bound, the bandwidth is (bytesIn + bytesOut) / time
+
+typedef Size_MatType ElemwiseBandwidth;
+
+PERF_TEST_P_(ElemwiseBandwidth, add)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), b(sz, type), c(sz, type);
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::add(a, b, c);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, multiply)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), b(sz, type), c(sz, type);
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::multiply(a, b, c, 0.5);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, addWeighted)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), b(sz, type), c(sz, type);
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::addWeighted(a, 0.3, b, 0.7, 1, c);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, compare)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), b(sz, type), c(sz, CV_8UC(CV_MAT_CN(type)));
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::compare(a, b, c, CMP_GT);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, inRange)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), c(sz, CV_8UC1);
+    declare.in(a, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::inRange(a, Scalar::all(10), Scalar::all(100), c);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, convertTo)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    int dtype = CV_MAT_DEPTH(type) == CV_32F ? CV_16S : CV_32F;
+    Mat a(sz, type), c(sz, CV_MAKETYPE(dtype, CV_MAT_CN(type)));
+    declare.in(a, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() a.convertTo(c, dtype, 2.0, 1.0);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseBandwidth, convertScaleAbs)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    Mat a(sz, type), c(sz, CV_8UC(CV_MAT_CN(type)));
+    declare.in(a, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::convertScaleAbs(a, c, 2.0, 1.0);
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/*nothing*/ , ElemwiseBandwidth,
+    testing::Combine(
+        testing::Values(sz1080p, sz2160p, sz4320p),
+        testing::Values(CV_8UC1, CV_8UC3, CV_32FC1)
+    )
+);
+
 ///////////// Rotate ////////////////////////
 
 typedef perf::TestBaseWithParam<std::tuple<cv::Size, int, perf::MatType>> RotateTest;
@@ -36,6 +36,28 @@ PERF_TEST_P(VectorLength, phase64f, testing::Values(128, 1000, 128*1024, 512*102
     SANITY_CHECK(angle, 5e-5);
 }
 
+CV_ENUM(GemmFlags, 0, GEMM_1_T, GEMM_2_T, GEMM_1_T|GEMM_2_T, GEMM_3_T)
+
+typedef perf::TestBaseWithParam<std::tuple<int, GemmFlags, MatType>> GemmTest;
+
+PERF_TEST_P(GemmTest, gemm, ::testing::Combine(
+    ::testing::Values(64, 256, 1024),
+    GemmFlags::all(),
+    ::testing::Values(CV_32FC1, CV_64FC1, CV_32FC2, CV_64FC2)
+    ))
+{
+    int size = std::get<0>(GetParam());
+    int flags = std::get<1>(GetParam());
+    int type = std::get<2>(GetParam());
+
+    Mat A(size, size, type), B(size, size, type), C(size, size, type), D(size, size, type);
+    declare.in(A, B, C, WARMUP_RNG).out(D);
+
+    TEST_CYCLE() cv::gemm(A, B, 0.5, C, 2.0, D, flags);
+
+    SANITY_CHECK_NOTHING();
+}
+
 // generates random vectors, performs Gram-Schmidt orthogonalization on them
 Mat randomOrtho(int rows, int ftype, RNG& rng)
 {
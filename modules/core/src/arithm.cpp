@@ -49,10 +49,61 @@
 
 #include "precomp.hpp"
 #include "opencl_kernels_core.hpp"
+#include <opencv2/core/utils/configuration.private.hpp>
 
 namespace cv
 {
 
+/****************************************************************************************\
+*                              parallel element-wise operations                          *
+\****************************************************************************************/
+
+// Element-wise operations are memory bound and a few threads already saturate the memory
+// bandwidth, so large arrays are split into a few big stripes rather than one per thread.
+// The limit is about two stripes per memory channel of the machine.
+static int getElemwiseMaxStripes()
+{
+    static int value = (int)utils::getConfigurationParameterSizeT("OPENCV_CORE_ELEMWISE_MAX_STRIPES", 8);
+    return value;
+}
+
+enum { ELEMWISE_PARALLEL_MIN_BYTES = 1 << 21, ELEMWISE_STRIPE_MIN_BYTES = 1 << 20, ELEMWISE_CHUNK_ALIGN = 64 };
+
+void parallelForElemwise(Size sz, size_t bytesPerUnit, const std::function<void(const Rect&)>& body)
+{
+    const double total_bytes = (double)sz.width*sz.height*bytesPerUnit;
+    int nstripes = 1;
+    if (total_bytes >= ELEMWISE_PARALLEL_MIN_BYTES)
+        nstripes = (int)std::min((double)std::min(getNumThreads(), getElemwiseMaxStripes()),
+                                 total_bytes/ELEMWISE_STRIPE_MIN_BYTES);
+    if (nstripes <= 1)
+    {
+        body(Rect(0, 0, sz.width, sz.height));
+        return;
+    }
+
+    if (sz.height >= nstripes)
+    {
+        parallel_for_(Range(0, sz.height), [&](const Range& r)
+        {
+            body(Rect(0, r.start, sz.width, r.end - r.start));
+        }, nstripes);
+        return;
+    }
+
+    const int chunks_per_row = (nstripes + sz.height - 1)/sz.height;
+    const int chunk = (int)alignSize((sz.width + chunks_per_row - 1)/chunks_per_row, ELEMWISE_CHUNK_ALIGN);
+    const int ncols = (sz.width + chunk - 1)/chunk;
+    parallel_for_(Range(0, sz.height*ncols), [&](const Range& r)
+    {
+        for (int i = r.start; i < r.end; i++)
+        {
+            int y = i/ncols, x = (i % ncols)*chunk;
+            body(Rect(x, y, std::min(chunk, sz.width - x), 1));
+        }
+    }, nstripes);
+}
+
 /****************************************************************************************\
 *                                   logical operations                                   *
 \****************************************************************************************/
@@ -189,7 +240,12 @@ static void binary_op( InputArray _src1, InputArray _src2, OutputArray _dst,
         if (len < INT_MAX)  // FIXIT similar code below doesn't have that check
         {
             sz.width = (int)len;
-            func(src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, 0);
+            const size_t esz1 = CV_ELEM_SIZE(type1)/cn;
+            parallelForElemwise(sz, esz1*3, [&](const Rect& r)
+            {
+                func(src1.ptr(r.y) + r.x*esz1, src1.step, src2.ptr(r.y) + r.x*esz1, src2.step,
+                     dst.ptr(r.y) + r.x*esz1, dst.step, r.width, r.height, 0);
+            });
             return;
         }
     }
@@ -622,13 +678,20 @@ static void arithm_op(InputArray _src1, InputArray _src2, OutputArray _dst,
 
         Mat src1 = psrc1->getMat(), src2 = psrc2->getMat(), dst = _dst.getMat();
         Size sz = getContinuousSize2D(src1, src2, dst, src1.channels());
-        if (!extendedFunc || extendedFunc(src1.ptr(), src1.step, src2.ptr(), src2.step,
-                                          dst.ptr(), dst.step, sz.width, sz.height, usrdata) != 0)
+        BinaryFuncC func = tab[depth1];
+        const size_t esz1 = CV_ELEM_SIZE1(type1);
+        parallelForElemwise(sz, esz1*3, [&](const Rect& r)
         {
-            BinaryFuncC func = tab[depth1];
-            CV_Assert(func);
-            func(src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, usrdata);
-        }
+            const uchar* sptr1 = src1.ptr(r.y) + r.x*esz1;
+            const uchar* sptr2 = src2.ptr(r.y) + r.x*esz1;
+            uchar* dptr = dst.ptr(r.y) + r.x*esz1;
+            if (!extendedFunc || extendedFunc(sptr1, src1.step, sptr2, src2.step,
+                                              dptr, dst.step, r.width, r.height, usrdata) != 0)
+            {
+                CV_Assert(func);
+                func(sptr1, src1.step, sptr2, src2.step, dptr, dst.step, r.width, r.height, usrdata);
+            }
+        });
         return;
     }
 
@@ -1364,7 +1427,12 @@ void cv::compare(InputArray _src1, InputArray _src2, OutputArray _dst, int op)
         Size sz = getContinuousSize2D(src1, src2, dst, src1.channels());
         BinaryFuncC cmpFn = getCmpFunc(depth1);
         CV_Assert(cmpFn);
-        cmpFn(src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, &op);
+        const size_t esz1 = src1.elemSize1();
+        parallelForElemwise(sz, esz1*2 + 1, [&](const Rect& r)
+        {
+            cmpFn(src1.ptr(r.y) + r.x*esz1, src1.step, src2.ptr(r.y) + r.x*esz1, src2.step,
+                  dst.ptr(r.y) + r.x, dst.step, r.width, r.height, &op);
+        });
         return;
     }
 
@@ -1939,6 +2007,32 @@ void cv::inRange(InputArray _src, InputArray _lowerb,
         convertAndUnrollScalar( ub, src.type(), ubuf, blocksize );
     }
 
+    if( it.nplanes == 1 )
+    {
+        // the blocks of a single plane are independent, process them in parallel
+        const uchar* sptr = ptrs[0];
+        uchar* dptr = ptrs[1];
+        const uchar* lptr0 = !lbScalar ? ptrs[2] : 0;
+        const uchar* uptr0 = !ubScalar ? ptrs[!lbScalar ? 3 : 2] : 0;
+        const int nblocks = (int)((total + blocksize - 1)/blocksize);
+        parallelForElemwise(Size(nblocks, 1), blocksize*(esz*(lbScalar ? 1 : 3) + 1), [&](const Rect& r)
+        {
+            AutoBuffer<uchar> _mbuf(cn > 1 ? blocksize*cn : 1);
+            for( int b = r.x; b < r.x + r.width; b++ )
+            {
+                size_t j = (size_t)b*blocksize;
+                int bsz = (int)MIN(total - j, blocksize);
+                const uchar* lptr = lbScalar ? lbuf : lptr0 + j*esz;
+                const uchar* uptr = ubScalar ? ubuf : uptr0 + j*esz;
+                uchar* mptr = cn == 1 ? dptr + j : _mbuf.data();
+                func( sptr + j*esz, 0, lptr, 0, uptr, 0, mptr, 0, Size(bsz*cn, 1));
+                if( cn > 1 )
+                    inRangeReduce(mptr, dptr + j, bsz, cn);
+            }
+        });
+        return;
+    }
+
     for( size_t i = 0; i < it.nplanes; i++, ++it )
     {
         for( size_t j = 0; j < total; j += blocksize )
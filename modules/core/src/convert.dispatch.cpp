@@ -288,7 +288,11 @@ void Mat::convertTo(OutputArray dst, int type_, double alpha, double beta) const
     if( dims <= 2 )
     {
         Size sz = getContinuousSize2D(src, dstMat, cn);
-        func(src.data, src.step, 0, 0, dstMat.data, dstMat.step, sz, scale);
+        const size_t sesz1 = src.elemSize1(), desz1 = dstMat.elemSize1();
+        parallelForElemwise(sz, sesz1 + desz1, [&](const Rect& r)
+        {
+            func(src.ptr(r.y) + r.x*sesz1, src.step, 0, 0, dstMat.ptr(r.y) + r.x*desz1, dstMat.step, r.size(), scale);
+        });
     }
     else
     {
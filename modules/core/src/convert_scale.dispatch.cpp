@@ -102,7 +102,11 @@ void convertScaleAbs(InputArray _src, OutputArray _dst, double alpha, double bet
     if( src.dims <= 2 )
     {
         Size sz = getContinuousSize2D(src, dst, cn);
-        func( src.ptr(), src.step, 0, 0, dst.ptr(), dst.step, sz, scale );
+        const size_t esz1 = src.elemSize1();
+        parallelForElemwise(sz, esz1 + 1, [&](const Rect& r)
+        {
+            func( src.ptr(r.y) + r.x*esz1, src.step, 0, 0, dst.ptr(r.y) + r.x, dst.step, r.size(), scale );
+        });
     }
     else
     {
@@ -710,17 +710,20 @@ void repeat(InputArray _src, int ny, int nx, OutputArray _dst)
     Mat src = _src.getMat(), dst = _dst.getMat();
     Size dsize = dst.size();
     int esz = (int)src.elemSize();
-    int x, y;
     ssize.width *= esz; dsize.width *= esz;
 
-    for( y = 0; y < ssize.height; y++ )
+    // every destination row is produced from its source row, the copied part is doubled
+    // so that narrow sources are not copied element by element
+    parallel_for_(Range(0, dsize.height), [&](const Range& r)
     {
-        for( x = 0; x < dsize.width; x += ssize.width )
-            memcpy( dst.ptr(y) + x, src.ptr(y), ssize.width );
-    }
-
-    for( ; y < dsize.height; y++ )
-        memcpy( dst.ptr(y), dst.ptr(y - ssize.height), dsize.width );
+        for( int y = r.start; y < r.end; y++ )
+        {
+            uchar* d = dst.ptr(y);
+            memcpy( d, src.ptr(y % ssize.height), ssize.width );
+            for( int x = ssize.width; x < dsize.width; x *= 2 )
+                memcpy( d + x, d, std::min(x, dsize.width - x) );
+        }
+    }, (double)dsize.area()/(1 << 16));
 }
 
 Mat repeat(const Mat& src, int ny, int nx)
@@ -116,6 +116,22 @@ static bool ipp_countNonZero( Mat &src, int &res )
 }
 #endif
 
+static int countNonZero_(const Mat& src)
+{
+    CountNonZeroFunc func = getCountNonZeroTab(src.depth());
+    CV_Assert( func != 0 );
+
+    const Mat* arrays[] = {&src, 0};
+    uchar* ptrs[1] = {};
+    NAryMatIterator it(arrays, ptrs);
+    int total = (int)it.size, nz = 0;
+
+    for( size_t i = 0; i < it.nplanes; i++, ++it )
+        nz += func( ptrs[0], total );
+
+    return nz;
+}
+
 int countNonZero(InputArray _src)
 {
     CV_INSTRUMENT_REGION();
@@ -136,18 +152,14 @@ int countNonZero(InputArray _src)
     Mat src = _src.getMat();
     CV_IPP_RUN_FAST(ipp_countNonZero(src, res), res);
 
-    CountNonZeroFunc func = getCountNonZeroTab(src.depth());
-    CV_Assert( func != 0 );
-
-    const Mat* arrays[] = {&src, 0};
-    uchar* ptrs[1] = {};
-    NAryMatIterator it(arrays, ptrs);
-    int total = (int)it.size, nz = 0;
-
-    for( size_t i = 0; i < it.nplanes; i++, ++it )
-        nz += func( ptrs[0], total );
-
-    return nz;
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        return parallelReduce<int>(src.size(), nstripes,
+            [&](const Rect& r) { return countNonZero_(src(r)); },
+            [](int a, int b) { return a + b; });
+    }
+    return countNonZero_(src);
 }
 
 void findNonZero(InputArray _src, OutputArray _idx)
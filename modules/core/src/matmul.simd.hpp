@@ -728,6 +728,277 @@ static void GEMMStore_64fc( const Complexd* c_data, size_t c_step,
     GEMMStore(c_data, c_step, d_buf, d_buf_step, d_data, d_step, d_size, alpha, beta, flags);
 }
 
+/****************************************************************************************\
+*                                     Packed GEMM                                        *
+\****************************************************************************************/
+
+// D = alpha*op(A)*op(B) + beta*op(C) for the matrices large enough to amortize packing.
+// D is split into GEMM_MC x nc tiles which are processed in parallel. For every GEMM_KC slice
+// of the common dimension the panels of A and B used by the tile are copied into contiguous
+// zero-padded buffers (GEMM_MR rows / nr columns interleaved), so the register-blocked
+// micro-kernel reads both sequentially whatever the GEMM_*_T flags are.
+// Complex matrices are multiplied as real ones: a row of A is a sequence of (re, im) pairs and
+// every element of B is expanded into the 2x2 block [re, im; -im, re], so the product
+// directly has the interleaved (re, im) layout of D.
+
+enum { GEMM_MR = 4, GEMM_MC = 64, GEMM_KC = 256, GEMM_NC = 256 };
+
+// smaller products go to GEMMSingleMul
+enum { GEMM_MIN_SIZE = 16 };
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline v_float32 gemmSetAll(float x) { return vx_setall_f32(x); }
+#endif
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+static inline v_float64 gemmSetAll(double x) { return vx_setall_f64(x); }
+#endif
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+// c[GEMM_MR x 2*nlanes] += a[kc x GEMM_MR] * b[kc x 2*nlanes], both panels are packed
+template<typename T, typename VT> static void
+gemmKernelSIMD( int kc, const T* a, const T* b, T* c, int ldc )
+{
+    const int nlanes = VTraits<VT>::vlanes();
+    VT s00 = gemmSetAll((T)0), s01 = s00, s10 = s00, s11 = s00,
+       s20 = s00, s21 = s00, s30 = s00, s31 = s00;
+    for( int k = 0; k < kc; k++, a += GEMM_MR, b += nlanes*2 )
+    {
+        VT b0 = vx_load(b), b1 = vx_load(b + nlanes);
+        VT a0 = gemmSetAll(a[0]);
+        s00 = v_fma(a0, b0, s00); s01 = v_fma(a0, b1, s01);
+        a0 = gemmSetAll(a[1]);
+        s10 = v_fma(a0, b0, s10); s11 = v_fma(a0, b1, s11);
+        a0 = gemmSetAll(a[2]);
+        s20 = v_fma(a0, b0, s20); s21 = v_fma(a0, b1, s21);
+        a0 = gemmSetAll(a[3]);
+        s30 = v_fma(a0, b0, s30); s31 = v_fma(a0, b1, s31);
+    }
+    v_store(c, v_add(vx_load(c), s00)); v_store(c + nlanes, v_add(vx_load(c + nlanes), s01));
+    c += ldc;
+    v_store(c, v_add(vx_load(c), s10)); v_store(c + nlanes, v_add(vx_load(c + nlanes), s11));
+    c += ldc;
+    v_store(c, v_add(vx_load(c), s20)); v_store(c + nlanes, v_add(vx_load(c + nlanes), s21));
+    c += ldc;
+    v_store(c, v_add(vx_load(c), s30)); v_store(c + nlanes, v_add(vx_load(c + nlanes), s31));
+}
+#endif
+
+enum { GEMM_NR_SCALAR = 4 };
+
+template<typename T> static void
+gemmKernelScalar( int kc, const T* a, const T* b, T* c, int ldc )
+{
+    T s[GEMM_MR][GEMM_NR_SCALAR] = {};
+    for( int k = 0; k < kc; k++, a += GEMM_MR, b += GEMM_NR_SCALAR )
+        for( int i = 0; i < GEMM_MR; i++ )
+            for( int j = 0; j < GEMM_NR_SCALAR; j++ )
+                s[i][j] += a[i]*b[j];
+    for( int i = 0; i < GEMM_MR; i++, c += ldc )
+        for( int j = 0; j < GEMM_NR_SCALAR; j++ )
+            c[j] += s[i][j];
+}
+
+// the number of columns of D computed by the micro-kernel
+template<typename T> static int gemmNR();
+
+template<> int gemmNR<float>()
+{
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    return VTraits<v_float32>::vlanes()*2;
+#else
+    return GEMM_NR_SCALAR;
+#endif
+}
+
+template<> int gemmNR<double>()
+{
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+    return VTraits<v_float64>::vlanes()*2;
+#else
+    return GEMM_NR_SCALAR;
+#endif
+}
+
+static inline void gemmKernel( int kc, const float* a, const float* b, float* c, int ldc )
+{
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    gemmKernelSIMD<float, v_float32>(kc, a, b, c, ldc);
+#else
+    gemmKernelScalar(kc, a, b, c, ldc);
+#endif
+}
+
+static inline void gemmKernel( int kc, const double* a, const double* b, double* c, int ldc )
+{
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+    gemmKernelSIMD<double, v_float64>(kc, a, b, c, ldc);
+#else
+    gemmKernelScalar(kc, a, b, c, ldc);
+#endif
+}
+
+// Strides are in the elements of T; the element (i, j) of a real matrix is at i*step0 + j*step1.
+// For the complex matrices the column index j runs over the interleaved (re, im) values,
+// i.e. the real value (i, j) is at i*step0 + (j/2)*step1 + j%2.
+struct GemmOperand
+{
+    const void* data;
+    size_t step0, step1;
+};
+
+template<typename T> static void
+gemmPackA( const GemmOperand& A, bool cplx, int i0, int mc, int M, int k0, int kc, T* buf )
+{
+    const T* a = (const T*)A.data;
+    const int cshift = cplx ? 1 : 0, cmask = cplx ? 1 : 0;
+    for( int i = 0; i < mc; i += GEMM_MR )
+    {
+        for( int ii = 0; ii < GEMM_MR; ii++ )
+        {
+            T* dst = buf + i*kc + ii;
+            if( i0 + i + ii >= M )
+            {
+                for( int k = 0; k < kc; k++ )
+                    dst[k*GEMM_MR] = 0;
+                continue;
+            }
+            const T* row = a + (size_t)(i0 + i + ii)*A.step0;
+            for( int k = 0; k < kc; k++ )
+            {
+                int kk = k0 + k;
+                dst[k*GEMM_MR] = row[(size_t)(kk >> cshift)*A.step1 + (kk & cmask)];
+            }
+        }
+    }
+}
+
+template<typename T> static void
+gemmPackB( const GemmOperand& B, bool cplx, int k0, int kc, int j0, int nc, int N, int nr, T* buf )
+{
+    const T* b = (const T*)B.data;
+    for( int j = 0; j < nc; j += nr )
+    {
+        T* dst = buf + (size_t)j*kc;
+        for( int k = 0; k < kc; k++, dst += nr )
+        {
+            int kk = k0 + k;
+            int jj = j0 + j, jend = std::min(jj + nr, N) - jj;
+            int jn = 0;
+            if( !cplx )
+            {
+                const T* row = b + (size_t)kk*B.step0 + (size_t)jj*B.step1;
+                if( B.step1 == 1 )
+                    for( ; jn < jend; jn++ )
+                        dst[jn] = row[jn];
+                else
+                    for( ; jn < jend; jn++ )
+                        dst[jn] = row[(size_t)jn*B.step1];
+            }
+            else
+            {
+                // [re, im; -im, re] block of the element (kk/2, jj/2)
+                const T* row = b + (size_t)(kk >> 1)*B.step0;
+                for( ; jn < jend; jn++ )
+                {
+                    int jc = jj + jn;
+                    const T* v = row + (size_t)(jc >> 1)*B.step1;
+                    dst[jn] = (kk & 1) == 0 ? v[jc & 1] : (jc & 1) == 0 ? -v[1] : v[0];
+                }
+            }
+            for( ; jn < nr; jn++ )
+                dst[jn] = 0;
+        }
+    }
+}
+
+// M, N, K are the sizes of the real problem (for complex matrices N and K are doubled)
+template<typename T> static void
+gemmPacked( const GemmOperand& A, const GemmOperand& B, const GemmOperand& C, bool cplx,
+            T* d, size_t d_step, int M, int N, int K, T alpha, T beta )
+{
+    const int nr = gemmNR<T>();
+    const int nc0 = std::max(GEMM_NC / nr, 1)*nr;
+    const int kc0 = GEMM_KC;
+    const int tiles_m = (M + GEMM_MC - 1) / GEMM_MC, tiles_n = (N + nc0 - 1) / nc0;
+    const int cshift = cplx ? 1 : 0, cmask = cplx ? 1 : 0;
+    const double work = (double)M*N*K;
+
+    parallel_for_(Range(0, tiles_m*tiles_n), [&](const Range& range)
+    {
+        AutoBuffer<T> buf((size_t)GEMM_MC*kc0 + (size_t)kc0*nc0 + (size_t)GEMM_MC*nc0);
+        T* a_buf = buf.data();
+        T* b_buf = a_buf + (size_t)GEMM_MC*kc0;
+        T* acc = b_buf + (size_t)kc0*nc0;
+
+        for( int tile = range.start; tile < range.end; tile++ )
+        {
+            const int i0 = (tile / tiles_n)*GEMM_MC, j0 = (tile % tiles_n)*nc0;
+            const int mc = std::min((int)GEMM_MC, M - i0), nc = std::min(nc0, N - j0);
+            const int mc_pad = (mc + GEMM_MR - 1) / GEMM_MR*GEMM_MR;
+            const int nc_pad = (nc + nr - 1) / nr*nr;
+
+            std::fill(acc, acc + (size_t)mc_pad*nc0, (T)0);
+            for( int k0 = 0; k0 < K; k0 += kc0 )
+            {
+                const int kc = std::min(kc0, K - k0);
+                gemmPackA(A, cplx, i0, mc_pad, M, k0, kc, a_buf);
+                gemmPackB(B, cplx, k0, kc, j0, nc_pad, N, nr, b_buf);
+                for( int j = 0; j < nc_pad; j += nr )
+                    for( int i = 0; i < mc_pad; i += GEMM_MR )
+                        gemmKernel(kc, a_buf + (size_t)i*kc, b_buf + (size_t)j*kc,
+                                   acc + (size_t)i*nc0 + j, nc0);
+            }
+
+            for( int i = 0; i < mc; i++ )
+            {
+                const T* src = acc + (size_t)i*nc0;
+                T* dst = (T*)((uchar*)d + (size_t)(i0 + i)*d_step) + j0;
+                if( !C.data )
+                {
+                    for( int j = 0; j < nc; j++ )
+                        dst[j] = alpha*src[j];
+                }
+                else
+                {
+                    const T* c = (const T*)C.data + (size_t)(i0 + i)*C.step0;
+                    for( int j = 0; j < nc; j++ )
+                    {
+                        int jc = j0 + j;
+                        dst[j] = alpha*src[j] + beta*c[(size_t)(jc >> cshift)*C.step1 + (jc & cmask)];
+                    }
+                }
+            }
+        }
+    }, work >= (double)(1 << 21) ? tiles_m*tiles_n : 1);
+}
+
+template<typename T> static void
+gemmPackedImpl( const Mat& A, const Mat& B, double alpha, const Mat& C, double beta,
+                Mat& D, int flags, int len )
+{
+    const bool cplx = D.channels() == 2;
+    const size_t cn = cplx ? 2 : 1;
+    GemmOperand a, b, c;
+    a.data = A.data; b.data = B.data; c.data = C.data;
+    if( !(flags & GEMM_1_T) )
+        a.step0 = A.step/sizeof(T), a.step1 = cn;
+    else
+        a.step0 = cn, a.step1 = A.step/sizeof(T);
+    if( !(flags & GEMM_2_T) )
+        b.step0 = B.step/sizeof(T), b.step1 = cn;
+    else
+        b.step0 = cn, b.step1 = B.step/sizeof(T);
+    if( C.empty() )
+        c.data = 0, c.step0 = c.step1 = 0;
+    else if( !(flags & GEMM_3_T) )
+        c.step0 = C.step/sizeof(T), c.step1 = cn;
+    else
+        c.step0 = cn, c.step1 = C.step/sizeof(T);
+
+    gemmPacked<T>(a, b, c, cplx, D.ptr<T>(), D.step, D.rows, D.cols*(int)cn, len*(int)cn,
+                  (T)alpha, (T)beta);
+}
+
 static void gemmImpl( Mat A, Mat B, double alpha,
            Mat C, double beta, Mat D, int flags )
 {
@@ -1062,6 +1333,15 @@ static void gemmImpl( Mat A, Mat B, double alpha,
         flags |= GEMM_2_T;
     }
 
+    if( d_size.width >= GEMM_MIN_SIZE && d_size.height >= GEMM_MIN_SIZE && len >= GEMM_MIN_SIZE )
+    {
+        if( CV_MAT_DEPTH(type) == CV_32F )
+            gemmPackedImpl<float>(A, B, alpha, C, beta, D, flags, len);
+        else
+            gemmPackedImpl<double>(A, B, alpha, C, beta, D, flags, len);
+        return;
+    }
+
     /*if( (d_size.width | d_size.height | len) >= 16 && icvBLAS_GEMM_32f_p != 0 )
     {
         blas_func = type == CV_32FC1 ? (icvBLAS_GEMM_32f_t)icvBLAS_GEMM_32f_p :
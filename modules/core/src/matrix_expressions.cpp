@@ -12,6 +12,10 @@
 #include "precomp.hpp"
 #include <opencv2/core/utils/logger.hpp>
 
+#include "matrix_expressions.hpp"
+#include "matrix_expressions.simd.hpp"
+#include "matrix_expressions.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+
 namespace cv
 {
 
@@ -200,6 +204,26 @@ static MatOp_Initializer* getGlobalMatOpInitializer()
     CV_SINGLETON_LAZY_INIT(MatOp_Initializer, new MatOp_Initializer())
 }
 
+// Element-wise expression evaluated in a single pass: a and b are the matrix operands,
+// c is the postfix program (see matrix_expressions.hpp), flags is the result type
+class MatOp_Fused CV_FINAL : public MatOp
+{
+public:
+    MatOp_Fused() {}
+    virtual ~MatOp_Fused() {}
+
+    bool elementWise(const MatExpr& /*expr*/) const CV_OVERRIDE { return true; }
+    void assign(const MatExpr& expr, Mat& m, int type=-1) const CV_OVERRIDE;
+
+    void roi(const MatExpr& expr, const Range& rowRange, const Range& colRange, MatExpr& res) const CV_OVERRIDE;
+    void diag(const MatExpr& expr, int d, MatExpr& res) const CV_OVERRIDE;
+
+    Size size(const MatExpr& expr) const CV_OVERRIDE { return expr.a.size(); }
+    int type(const MatExpr& expr) const CV_OVERRIDE { return expr.flags; }
+};
+
+static MatOp_Fused g_MatOp_Fused;
+
 static inline bool isIdentity(const MatExpr& e) { return e.op == &g_MatOp_Identity; }
 static inline bool isAddEx(const MatExpr& e) { return e.op == &g_MatOp_AddEx; }
 static inline bool isScaled(const MatExpr& e) { return isAddEx(e) && (!e.b.data || e.beta == 0) && e.s == Scalar(); }
@@ -212,6 +236,266 @@ static inline bool isSolve(const MatExpr& e) { return e.op == &g_MatOp_Solve; }
 //static inline bool isGEMM(const MatExpr& e) { return e.op == &g_MatOp_GEMM; }
 static inline bool isMatProd(const MatExpr& e) { return e.op == &g_MatOp_GEMM && (!e.c.data || e.beta == 0); }
 static inline bool isInitializer(const MatExpr& e) { return e.op == getGlobalMatOpInitializer(); }
+static inline bool isFused(const MatExpr& e) { return e.op == &g_MatOp_Fused; }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static FusedExprFunc getFusedExprFunc(int depth)
+{
+    CV_INSTRUMENT_REGION();
+    CV_CPU_DISPATCH(getFusedExprFunc, (depth), CV_CPU_DISPATCH_MODES_ALL);
+}
+
+// Expressions which can be inlined into a fused expression
+static bool isFusable(const MatExpr& e)
+{
+    if( !isIdentity(e) && !isAddEx(e) && !isFused(e) &&
+        !(e.op == &g_MatOp_Bin && e.flags != 0 && strchr("*/mMnNa", e.flags)) )
+        return false;
+    int type = e.type(), depth = CV_MAT_DEPTH(type);
+    return (depth == CV_32F || depth == CV_64F) && CV_MAT_CN(type) <= 4 && e.a.dims <= 2;
+}
+
+// Operands which would be evaluated by a separate pass otherwise:
+// in sums (see MatOp::add()), in products (see MatOp::multiply()) and in the other operations
+static inline bool isComplexTerm(const MatExpr& e)
+{
+    return isFusable(e) && !isIdentity(e) && !(isAddEx(e) && (!e.b.data || e.beta == 0));
+}
+
+static inline bool isComplexFactor(const MatExpr& e)
+{
+    return isFusable(e) && !isIdentity(e) && !isScaled(e) && !isReciprocal(e);
+}
+
+static inline bool isComplex(const MatExpr& e)
+{
+    return isFusable(e) && !isIdentity(e);
+}
+
+// Collects the program of a fused expression. Sub-expressions are inlined,
+// any failure (unsupported expression, too many operands, type mismatch) is sticky.
+class FusedExprBuilder
+{
+public:
+    FusedExprBuilder(const MatExpr& e) : type(e.type()), size(e.size()), noperands(0), sp(0), maxsp(0), lastop(-1), ok(true) {}
+
+    void append(const MatExpr& e)
+    {
+        if( !ok || !isFusable(e) || e.type() != type )
+        {
+            ok = false;
+            return;
+        }
+        if( isIdentity(e) )
+            appendMat(e.a);
+        else if( isAddEx(e) )
+        {
+            appendMat(e.a);
+            if( e.alpha != 1 )
+            {
+                appendConst(Scalar::all(e.alpha));
+                appendOp(FUSED_MUL);
+            }
+            if( e.b.data )
+            {
+                appendMat(e.b);
+                if( e.beta == -1 )
+                    appendOp(FUSED_SUB);
+                else
+                {
+                    if( e.beta != 1 )
+                    {
+                        appendConst(Scalar::all(e.beta));
+                        appendOp(FUSED_MUL);
+                    }
+                    appendOp(FUSED_ADD);
+                }
+            }
+            // a real scalar is added to all the channels or to the first one, see MatOp_AddEx::assign()
+            Scalar s = e.s;
+            if( s.isReal() && (e.b.data || fabs(e.alpha) != 1) )
+                s = Scalar::all(s[0]);
+            if( s != Scalar() )
+            {
+                appendConst(s);
+                appendOp(FUSED_ADD);
+            }
+        }
+        else if( isFused(e) )
+        {
+            const double* p = e.c.ptr<double>();
+            for( int k = 0, n = (int)e.c.total(); k < n; k += fusedOpLength((int)p[k]) )
+            {
+                int op = (int)p[k];
+                if( op == FUSED_LOAD )
+                    appendMat(p[k + 1] == 0 ? e.a : e.b);
+                else if( op == FUSED_CONST )
+                    appendConst(Scalar(p[k + 1], p[k + 2], p[k + 3], p[k + 4]));
+                else
+                    appendOp(op, op == FUSED_CMP ? (int)p[k + 1] : -1);
+            }
+        }
+        else
+        {
+            switch( e.flags )
+            {
+            case '*':
+                if( e.alpha != 1 )
+                    appendConst(Scalar::all(e.alpha));
+                appendMat(e.a);
+                if( e.alpha != 1 )
+                    appendOp(FUSED_MUL);
+                appendMat(e.b);
+                appendOp(FUSED_MUL);
+                break;
+            case '/':
+                if( !e.b.data )
+                {
+                    appendConst(Scalar::all(e.alpha));
+                    appendMat(e.a);
+                }
+                else
+                {
+                    appendMat(e.a);
+                    if( e.alpha != 1 )
+                    {
+                        appendConst(Scalar::all(e.alpha));
+                        appendOp(FUSED_MUL);
+                    }
+                    appendMat(e.b);
+                }
+                appendOp(FUSED_DIV);
+                break;
+            case 'm':
+            case 'M':
+                appendMat(e.a);
+                appendMat(e.b);
+                appendOp(e.flags == 'm' ? FUSED_MIN : FUSED_MAX);
+                break;
+            case 'n':
+            case 'N':
+                appendMat(e.a);
+                appendConst(Scalar::all(e.s[0]));
+                appendOp(e.flags == 'n' ? FUSED_MIN : FUSED_MAX);
+                break;
+            default: // 'a'
+                appendMat(e.a);
+                if( e.b.data )
+                    appendMat(e.b);
+                else
+                    appendConst(e.s);
+                appendOp(FUSED_SUB);
+                appendOp(FUSED_ABS);
+            }
+        }
+    }
+
+    void appendConst(const Scalar& s)
+    {
+        prog.push_back(FUSED_CONST);
+        lastop = FUSED_CONST;
+        for( int i = 0; i < 4; i++ )
+            prog.push_back(s[i]);
+        push(1);
+    }
+
+    void appendOp(int op, int arg=-1)
+    {
+        prog.push_back(op);
+        lastop = op;
+        if( op == FUSED_CMP )
+            prog.push_back(arg);
+        push(op == FUSED_ABS ? 0 : -1);
+    }
+
+    // res = the collected expression, false if it can't be fused
+    bool makeExpr(MatExpr& res) const
+    {
+        // the comparisons produce single-channel masks only
+        bool mask = lastop == FUSED_CMP;
+        if( !ok || sp != 1 || maxsp > FUSED_MAX_STACK || (mask && CV_MAT_CN(type) != 1) )
+            return false;
+        res = MatExpr(&g_MatOp_Fused, mask ? CV_8U : type, operands[0], operands[1],
+                      Mat(prog, true).reshape(1, 1));
+        return true;
+    }
+
+private:
+    void appendMat(const Mat& m)
+    {
+        if( !ok || m.type() != type || m.dims > 2 || m.size() != size )
+        {
+            ok = false;
+            return;
+        }
+        int i = 0;
+        for( ; i < noperands; i++ )
+            if( operands[i].data == m.data && operands[i].step == m.step )
+                break;
+        if( i == noperands )
+        {
+            if( noperands == FUSED_MAX_OPERANDS )
+            {
+                ok = false;
+                return;
+            }
+            operands[noperands++] = m;
+        }
+        prog.push_back(FUSED_LOAD);
+        prog.push_back(i);
+        lastop = FUSED_LOAD;
+        push(1);
+    }
+
+    void push(int n)
+    {
+        sp += n;
+        maxsp = std::max(maxsp, sp);
+        ok = ok && sp > 0;
+    }
+
+    int type;
+    Size size;
+    std::vector<double> prog;
+    Mat operands[FUSED_MAX_OPERANDS];
+    int noperands, sp, maxsp, lastop;
+    bool ok;
+};
+
+// res = e1 op e2 or, with e2 == 0, res = op e1 (scaled), as a single-pass expression
+static bool fuseExpr(MatExpr& res, int op, const MatExpr& e1, const MatExpr* e2, double scale=1, int cmpop=-1)
+{
+    FusedExprBuilder b(e1);
+    b.append(e1);
+    if( op == FUSED_DIV && scale != 1 )
+    {
+        b.appendConst(Scalar::all(scale));
+        b.appendOp(FUSED_MUL);
+    }
+    if( e2 )
+        b.append(*e2);
+    b.appendOp(op, cmpop);
+    if( op != FUSED_DIV && scale != 1 )
+    {
+        b.appendConst(Scalar::all(scale));
+        b.appendOp(FUSED_MUL);
+    }
+    return b.makeExpr(res);
+}
+
+// res = e op s or res = s op e
+static bool fuseExpr(MatExpr& res, int op, const MatExpr& e, const Scalar& s, bool scalarFirst, int cmpop=-1)
+{
+    FusedExprBuilder b(e);
+    if( scalarFirst )
+        b.appendConst(s);
+    b.append(e);
+    if( !scalarFirst )
+        b.appendConst(s);
+    b.appendOp(op, cmpop);
+    return b.makeExpr(res);
+}
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -329,6 +613,9 @@ void MatOp::add(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( (isComplexTerm(e1) || isComplexTerm(e2)) && fuseExpr(res, FUSED_ADD, e1, &e2) )
+            return;
+
         double alpha = 1, beta = 1;
         Scalar s;
         Mat m1, m2;
@@ -360,6 +647,9 @@ void MatOp::add(const MatExpr& expr1, const Scalar& s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( isComplex(expr1) && fuseExpr(res, FUSED_ADD, expr1, s, false) )
+        return;
+
     Mat m1;
     expr1.op->assign(expr1, m1);
     MatOp_AddEx::makeExpr(res, m1, Mat(), 1, 0, s);
@@ -372,6 +662,9 @@ void MatOp::subtract(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( (isComplexTerm(e1) || isComplexTerm(e2)) && fuseExpr(res, FUSED_SUB, e1, &e2) )
+            return;
+
         double alpha = 1, beta = -1;
         Scalar s;
         Mat m1, m2;
@@ -403,6 +696,9 @@ void MatOp::subtract(const Scalar& s, const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( isComplex(expr) && fuseExpr(res, FUSED_SUB, expr, s, true) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), -1, 0, s);
@@ -415,6 +711,9 @@ void MatOp::multiply(const MatExpr& e1, const MatExpr& e2, MatExpr& res, double
 
     if( this == e2.op )
     {
+        if( (isComplexFactor(e1) || isComplexFactor(e2)) && fuseExpr(res, FUSED_MUL, e1, &e2, scale) )
+            return;
+
         Mat m1, m2;
 
         if( isReciprocal(e1) )
@@ -466,6 +765,9 @@ void MatOp::multiply(const MatExpr& expr, double s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( isComplex(expr) && fuseExpr(res, FUSED_MUL, expr, Scalar::all(s), false) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), s, 0);
@@ -478,6 +780,9 @@ void MatOp::divide(const MatExpr& e1, const MatExpr& e2, MatExpr& res, double sc
 
     if( this == e2.op )
     {
+        if( (isComplexFactor(e1) || isComplexFactor(e2)) && fuseExpr(res, FUSED_DIV, e1, &e2, scale) )
+            return;
+
         if( isReciprocal(e1) && isReciprocal(e2) )
             MatOp_Bin::makeExpr(res, '/', e2.a, e1.a, e1.alpha/e2.alpha);
         else
@@ -518,6 +823,9 @@ void MatOp::divide(double s, const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( isComplex(expr) && fuseExpr(res, FUSED_DIV, expr, Scalar::all(s), true) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_Bin::makeExpr(res, '/', m, Mat(), s);
@@ -528,6 +836,9 @@ void MatOp::abs(const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( isComplex(expr) && fuseExpr(res, FUSED_ABS, expr, 0) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_Bin::makeExpr(res, 'a', m, Mat());
@@ -942,6 +1253,52 @@ MatExpr operator / (const MatExpr& e1, const MatExpr& e2)
     return en;
 }
 
+// Comparisons and min/max of the element-wise expressions are fused with them,
+// other expressions are evaluated first
+static MatExpr compareExpr(const MatExpr& e1, const MatExpr& e2, int cmpop)
+{
+    MatExpr res;
+    if( (isComplex(e1) || isComplex(e2)) && fuseExpr(res, FUSED_CMP, e1, &e2, 1, cmpop) )
+        return res;
+    Mat m1 = e1, m2 = e2;
+    checkOperandsExist(m1, m2);
+    MatOp_Cmp::makeExpr(res, cmpop, m1, m2);
+    return res;
+}
+
+static MatExpr compareExpr(const MatExpr& e, double s, int cmpop)
+{
+    MatExpr res;
+    if( isComplex(e) && fuseExpr(res, FUSED_CMP, e, Scalar::all(s), false, cmpop) )
+        return res;
+    Mat m = e;
+    checkOperandsExist(m);
+    MatOp_Cmp::makeExpr(res, cmpop, m, s);
+    return res;
+}
+
+static MatExpr minMaxExpr(const MatExpr& e1, const MatExpr& e2, bool isMax)
+{
+    MatExpr res;
+    if( (isComplex(e1) || isComplex(e2)) && fuseExpr(res, isMax ? FUSED_MAX : FUSED_MIN, e1, &e2) )
+        return res;
+    Mat m1 = e1, m2 = e2;
+    checkOperandsExist(m1, m2);
+    MatOp_Bin::makeExpr(res, isMax ? 'M' : 'm', m1, m2);
+    return res;
+}
+
+static MatExpr minMaxExpr(const MatExpr& e, double s, bool isMax)
+{
+    MatExpr res;
+    if( isComplex(e) && fuseExpr(res, isMax ? FUSED_MAX : FUSED_MIN, e, Scalar::all(s), false) )
+        return res;
+    Mat m = e;
+    checkOperandsExist(m);
+    MatOp_Bin::makeExpr(res, isMax ? 'N' : 'n', m, s);
+    return res;
+}
+
 MatExpr operator < (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -966,6 +1323,31 @@ MatExpr operator < (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator < (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_LT);
+}
+
+MatExpr operator < (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_LT);
+}
+
+MatExpr operator < (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_LT);
+}
+
+MatExpr operator < (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_GT);
+}
+
+MatExpr operator < (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_LT);
+}
+
 MatExpr operator <= (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -990,6 +1372,31 @@ MatExpr operator <= (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator <= (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_LE);
+}
+
+MatExpr operator <= (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_LE);
+}
+
+MatExpr operator <= (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_LE);
+}
+
+MatExpr operator <= (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_GE);
+}
+
+MatExpr operator <= (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_LE);
+}
+
 MatExpr operator == (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1014,6 +1421,31 @@ MatExpr operator == (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator == (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_EQ);
+}
+
+MatExpr operator == (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_EQ);
+}
+
+MatExpr operator == (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_EQ);
+}
+
+MatExpr operator == (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_EQ);
+}
+
+MatExpr operator == (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_EQ);
+}
+
 MatExpr operator != (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1038,6 +1470,31 @@ MatExpr operator != (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator != (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_NE);
+}
+
+MatExpr operator != (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_NE);
+}
+
+MatExpr operator != (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_NE);
+}
+
+MatExpr operator != (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_NE);
+}
+
+MatExpr operator != (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_NE);
+}
+
 MatExpr operator >= (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1062,6 +1519,31 @@ MatExpr operator >= (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator >= (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_GE);
+}
+
+MatExpr operator >= (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_GE);
+}
+
+MatExpr operator >= (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_GE);
+}
+
+MatExpr operator >= (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_LE);
+}
+
+MatExpr operator >= (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_GE);
+}
+
 MatExpr operator > (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1086,6 +1568,31 @@ MatExpr operator > (double s, const Mat& a)
     return e;
 }
 
+MatExpr operator > (const MatExpr& e, const Mat& m)
+{
+    return compareExpr(e, MatExpr(m), CV_CMP_GT);
+}
+
+MatExpr operator > (const Mat& m, const MatExpr& e)
+{
+    return compareExpr(MatExpr(m), e, CV_CMP_GT);
+}
+
+MatExpr operator > (const MatExpr& e, double s)
+{
+    return compareExpr(e, s, CV_CMP_GT);
+}
+
+MatExpr operator > (double s, const MatExpr& e)
+{
+    return compareExpr(e, s, CV_CMP_LT);
+}
+
+MatExpr operator > (const MatExpr& e1, const MatExpr& e2)
+{
+    return compareExpr(e1, e2, CV_CMP_GT);
+}
+
 MatExpr min(const Mat& a, const Mat& b)
 {
     CV_INSTRUMENT_REGION();
@@ -1116,6 +1623,41 @@ MatExpr min(double s, const Mat& a)
     return e;
 }
 
+MatExpr min(const MatExpr& e, const Mat& m)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, MatExpr(m), false);
+}
+
+MatExpr min(const Mat& m, const MatExpr& e)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(MatExpr(m), e, false);
+}
+
+MatExpr min(const MatExpr& e, double s)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, s, false);
+}
+
+MatExpr min(double s, const MatExpr& e)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, s, false);
+}
+
+MatExpr min(const MatExpr& e1, const MatExpr& e2)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e1, e2, false);
+}
+
 MatExpr max(const Mat& a, const Mat& b)
 {
     CV_INSTRUMENT_REGION();
@@ -1146,6 +1688,41 @@ MatExpr max(double s, const Mat& a)
     return e;
 }
 
+MatExpr max(const MatExpr& e, const Mat& m)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, MatExpr(m), true);
+}
+
+MatExpr max(const Mat& m, const MatExpr& e)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(MatExpr(m), e, true);
+}
+
+MatExpr max(const MatExpr& e, double s)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, s, true);
+}
+
+MatExpr max(double s, const MatExpr& e)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e, s, true);
+}
+
+MatExpr max(const MatExpr& e1, const MatExpr& e2)
+{
+    CV_INSTRUMENT_REGION();
+
+    return minMaxExpr(e1, e2, true);
+}
+
 MatExpr operator & (const Mat& a, const Mat& b)
 {
     checkOperandsExist(a, b);
@@ -1522,6 +2099,53 @@ inline void MatOp_Cmp::makeExpr(MatExpr& res, int cmpop, const Mat& a, double al
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void MatOp_Fused::assign(const MatExpr& e, Mat& m, int _type) const
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat temp, &dst = _type == -1 || _type == e.flags ? m : temp;
+    const Mat* operands[] = { &e.a, &e.b };
+    int depth = e.a.depth(), cn = e.a.channels();
+    FusedExprFunc func = getFusedExprFunc(depth);
+    CV_Assert(func);
+
+    dst.create(e.a.size(), e.flags);
+    const double* prog = e.c.ptr<double>();
+    int proglen = (int)e.c.total();
+    size_t esz = e.a.elemSize(), bytesPerPixel = dst.elemSize();
+    for( int i = 0; i < FUSED_MAX_OPERANDS; i++ )
+        bytesPerPixel += operands[i]->data ? esz : 0;
+
+    parallelForElemwise(dst.size(), bytesPerPixel, [&](const Rect& r)
+    {
+        const uchar* src[FUSED_MAX_OPERANDS] = {};
+        size_t srcstep[FUSED_MAX_OPERANDS] = {};
+        for( int i = 0; i < FUSED_MAX_OPERANDS; i++ )
+            if( operands[i]->data )
+            {
+                src[i] = operands[i]->ptr(r.y) + r.x*esz;
+                srcstep[i] = operands[i]->step;
+            }
+        func(prog, proglen, src, srcstep, dst.ptr(r.y) + r.x*dst.elemSize(), dst.step, r.size(), cn);
+    });
+
+    if( dst.data != m.data )
+        dst.convertTo(m, _type);
+}
+
+void MatOp_Fused::roi(const MatExpr& e, const Range& rowRange, const Range& colRange, MatExpr& res) const
+{
+    res = MatExpr(&g_MatOp_Fused, e.flags, e.a(rowRange, colRange),
+                  e.b.data ? e.b(rowRange, colRange) : Mat(), e.c);
+}
+
+void MatOp_Fused::diag(const MatExpr& e, int d, MatExpr& res) const
+{
+    res = MatExpr(&g_MatOp_Fused, e.flags, e.a.diag(d), e.b.data ? e.b.diag(d) : Mat(), e.c);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void MatOp_T::assign(const MatExpr& e, Mat& m, int _type) const
 {
     Mat temp, &dst = _type == -1 || _type == e.a.type() ? m : temp;
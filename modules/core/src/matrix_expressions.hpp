@@ -0,0 +1,43 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+
+#ifndef SRC_MATRIX_EXPRESSIONS_HPP
+#define SRC_MATRIX_EXPRESSIONS_HPP
+
+#include "opencv2/core/types.hpp"
+
+namespace cv {
+
+// Fused element-wise matrix expressions are postfix programs over up to FUSED_MAX_OPERANDS
+// matrices and per-channel constants. The program is stored as a sequence of doubles.
+enum FusedExprOp
+{
+    FUSED_LOAD = 0,     // followed by the operand index
+    FUSED_CONST = 1,    // followed by 4 values, one per channel
+    FUSED_ADD = 2,
+    FUSED_SUB = 3,
+    FUSED_MUL = 4,
+    FUSED_DIV = 5,
+    FUSED_MIN = 6,
+    FUSED_MAX = 7,
+    FUSED_ABS = 8,
+    FUSED_CMP = 9       // followed by the comparison code (CMP_*), the result is 255 or 0
+};
+
+enum { FUSED_MAX_OPERANDS = 2, FUSED_MAX_STACK = 8 };
+
+static inline int fusedOpLength(int op)
+{
+    return op == FUSED_CONST ? 5 : op == FUSED_LOAD || op == FUSED_CMP ? 2 : 1;
+}
+
+// Evaluates the program over sz.height rows of sz.width pixels with cn channels.
+// The result has the operands type, or CV_8U if the program ends with FUSED_CMP.
+typedef void (*FusedExprFunc)(const double* prog, int proglen, const uchar* const* src, const size_t* srcstep,
+                              uchar* dst, size_t dststep, Size sz, int cn);
+
+}
+
+#endif // SRC_MATRIX_EXPRESSIONS_HPP
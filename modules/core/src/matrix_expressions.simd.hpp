@@ -0,0 +1,274 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "matrix_expressions.hpp"
+
+namespace cv {
+
+CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
+
+FusedExprFunc getFusedExprFunc(int depth);
+
+
+#ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
+
+// Pixels per block, the intermediate results of a block stay in L1 cache
+enum { FUSED_BLOCK_SIZE = 256 };
+
+struct FusedAdd
+{
+    template<typename T> static T s(T x, T y) { return x + y; }
+    template<typename V> static V v(const V& x, const V& y) { return v_add(x, y); }
+};
+
+struct FusedSub
+{
+    template<typename T> static T s(T x, T y) { return x - y; }
+    template<typename V> static V v(const V& x, const V& y) { return v_sub(x, y); }
+};
+
+struct FusedMul
+{
+    template<typename T> static T s(T x, T y) { return x * y; }
+    template<typename V> static V v(const V& x, const V& y) { return v_mul(x, y); }
+};
+
+struct FusedDiv
+{
+    template<typename T> static T s(T x, T y) { return x / y; }
+    template<typename V> static V v(const V& x, const V& y) { return v_div(x, y); }
+};
+
+struct FusedMin
+{
+    template<typename T> static T s(T x, T y) { return std::min(x, y); }
+    template<typename V> static V v(const V& x, const V& y) { return v_min(x, y); }
+};
+
+struct FusedMax
+{
+    template<typename T> static T s(T x, T y) { return std::max(x, y); }
+    template<typename V> static V v(const V& x, const V& y) { return v_max(x, y); }
+};
+
+// the comparisons produce 255 or 0 of the operands type, converted to CV_8U at the end
+#define CV_FUSED_CMP_OP(name, op, vop) \
+struct name \
+{ \
+    template<typename T> static T s(T x, T y) { return x op y ? (T)255 : (T)0; } \
+    template<typename V> static V v(const V& x, const V& y) \
+    { \
+        typedef typename VTraits<V>::lane_type T; \
+        return v_and(vop(x, y), vx_setall<T>((T)255)); \
+    } \
+};
+
+CV_FUSED_CMP_OP(FusedCmpEQ, ==, v_eq)
+CV_FUSED_CMP_OP(FusedCmpGT, >, v_gt)
+CV_FUSED_CMP_OP(FusedCmpGE, >=, v_ge)
+CV_FUSED_CMP_OP(FusedCmpLT, <, v_lt)
+CV_FUSED_CMP_OP(FusedCmpLE, <=, v_le)
+CV_FUSED_CMP_OP(FusedCmpNE, !=, v_ne)
+
+#undef CV_FUSED_CMP_OP
+
+template<class Op>
+static int fusedBinaryV(const float* x, const float* y, float* dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int vlanes = VTraits<v_float32>::vlanes();
+    for( ; i <= len - vlanes; i += vlanes )
+        v_store(dst + i, Op::v(vx_load(x + i), vx_load(y + i)));
+    vx_cleanup();
+#else
+    CV_UNUSED(x); CV_UNUSED(y); CV_UNUSED(dst); CV_UNUSED(len);
+#endif
+    return i;
+}
+
+template<class Op>
+static int fusedBinaryV(const double* x, const double* y, double* dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+    const int vlanes = VTraits<v_float64>::vlanes();
+    for( ; i <= len - vlanes; i += vlanes )
+        v_store(dst + i, Op::v(vx_load(x + i), vx_load(y + i)));
+    vx_cleanup();
+#else
+    CV_UNUSED(x); CV_UNUSED(y); CV_UNUSED(dst); CV_UNUSED(len);
+#endif
+    return i;
+}
+
+template<typename T, class Op>
+static void fusedBinary(const T* x, const T* y, T* dst, int len)
+{
+    int i = fusedBinaryV<Op>(x, y, dst, len);
+    for( ; i < len; i++ )
+        dst[i] = Op::s(x[i], y[i]);
+}
+
+static int fusedAbsV(const float* x, float* dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int vlanes = VTraits<v_float32>::vlanes();
+    for( ; i <= len - vlanes; i += vlanes )
+        v_store(dst + i, v_abs(vx_load(x + i)));
+    vx_cleanup();
+#else
+    CV_UNUSED(x); CV_UNUSED(dst); CV_UNUSED(len);
+#endif
+    return i;
+}
+
+static int fusedAbsV(const double* x, double* dst, int len)
+{
+    int i = 0;
+#if (CV_SIMD_64F || CV_SIMD_SCALABLE_64F)
+    const int vlanes = VTraits<v_float64>::vlanes();
+    for( ; i <= len - vlanes; i += vlanes )
+        v_store(dst + i, v_abs(vx_load(x + i)));
+    vx_cleanup();
+#else
+    CV_UNUSED(x); CV_UNUSED(dst); CV_UNUSED(len);
+#endif
+    return i;
+}
+
+template<typename T>
+static void fusedAbs(const T* x, T* dst, int len)
+{
+    int i = fusedAbsV(x, dst, len);
+    for( ; i < len; i++ )
+        dst[i] = std::abs(x[i]);
+}
+
+template<typename T>
+static void fusedCmp(int cmpop, const T* x, const T* y, T* dst, int len)
+{
+    switch( cmpop )
+    {
+    case CMP_EQ: fusedBinary<T, FusedCmpEQ>(x, y, dst, len); break;
+    case CMP_GT: fusedBinary<T, FusedCmpGT>(x, y, dst, len); break;
+    case CMP_GE: fusedBinary<T, FusedCmpGE>(x, y, dst, len); break;
+    case CMP_LT: fusedBinary<T, FusedCmpLT>(x, y, dst, len); break;
+    case CMP_LE: fusedBinary<T, FusedCmpLE>(x, y, dst, len); break;
+    case CMP_NE: fusedBinary<T, FusedCmpNE>(x, y, dst, len); break;
+    default: CV_Error(Error::StsBadArg, "Unknown comparison operation");
+    }
+}
+
+// Runs the program block by block, so every element is loaded and stored once.
+// The operands and the constants (expanded to whole blocks) are read in place,
+// the intermediate results are kept in a stack of block buffers.
+template<typename T>
+static void fusedExpr_(const double* prog, int proglen, const uchar* const* src, const size_t* srcstep,
+                       uchar* dst, size_t dststep, Size sz, int cn)
+{
+    const int block = FUSED_BLOCK_SIZE*cn, width = sz.width*cn;
+    int nconst = 0, lastop = 0;
+    for( int k = 0; k < proglen; k += fusedOpLength((int)prog[k]) )
+    {
+        nconst += (int)prog[k] == FUSED_CONST;
+        lastop = (int)prog[k];
+    }
+    const bool mask = lastop == FUSED_CMP;
+
+    AutoBuffer<T> _buf((size_t)block*(FUSED_MAX_STACK + nconst));
+    T* regs = _buf.data();
+    T* consts = regs + (size_t)block*FUSED_MAX_STACK;
+    for( int k = 0, c = 0; k < proglen; k += fusedOpLength((int)prog[k]) )
+    {
+        if( (int)prog[k] != FUSED_CONST )
+            continue;
+        T* cbuf = consts + (size_t)block*c++;
+        for( int i = 0; i < block; i++ )
+            cbuf[i] = saturate_cast<T>(prog[k + 1 + i % cn]);
+    }
+
+    for( int y = 0; y < sz.height; y++ )
+    {
+        const T* srow[FUSED_MAX_OPERANDS] = {};
+        for( int j = 0; j < FUSED_MAX_OPERANDS; j++ )
+            if( src[j] )
+                srow[j] = (const T*)(src[j] + srcstep[j]*y);
+        uchar* drow = dst + dststep*y;
+
+        for( int x = 0; x < width; x += block )
+        {
+            const int len = std::min(block, width - x);
+            const T* stack[FUSED_MAX_STACK];
+            int sp = 0;
+
+            for( int k = 0, c = 0; k < proglen; )
+            {
+                const int op = (int)prog[k], oplen = fusedOpLength(op);
+                const bool last = k + oplen >= proglen;
+                if( op == FUSED_LOAD )
+                    stack[sp++] = srow[(int)prog[k + 1]] + x;
+                else if( op == FUSED_CONST )
+                    stack[sp++] = consts + (size_t)block*c++;
+                else
+                {
+                    const int nargs = op == FUSED_ABS ? 1 : 2;
+                    T* out = last && !mask ? (T*)drow + x : regs + (size_t)block*(sp - nargs);
+                    const T* a = stack[sp - nargs];
+                    const T* b = stack[sp - 1];
+                    switch( op )
+                    {
+                    case FUSED_ADD: fusedBinary<T, FusedAdd>(a, b, out, len); break;
+                    case FUSED_SUB: fusedBinary<T, FusedSub>(a, b, out, len); break;
+                    case FUSED_MUL: fusedBinary<T, FusedMul>(a, b, out, len); break;
+                    case FUSED_DIV: fusedBinary<T, FusedDiv>(a, b, out, len); break;
+                    case FUSED_MIN: fusedBinary<T, FusedMin>(a, b, out, len); break;
+                    case FUSED_MAX: fusedBinary<T, FusedMax>(a, b, out, len); break;
+                    case FUSED_ABS: fusedAbs<T>(a, out, len); break;
+                    case FUSED_CMP: fusedCmp<T>((int)prog[k + 1], a, b, out, len); break;
+                    default: CV_Error(Error::StsBadArg, "Unknown fused expression operation");
+                    }
+                    sp -= nargs;
+                    stack[sp++] = out;
+                }
+                k += oplen;
+            }
+            CV_DbgAssert(sp == 1);
+
+            if( mask )
+            {
+                const T* r = stack[0];
+                uchar* d = drow + x;
+                for( int i = 0; i < len; i++ )
+                    d[i] = (uchar)(int)r[i];
+            }
+            else if( stack[0] != (const T*)drow + x )
+                memcpy((T*)drow + x, stack[0], len*sizeof(T));
+        }
+    }
+}
+
+static void fusedExpr32f(const double* prog, int proglen, const uchar* const* src, const size_t* srcstep,
+                         uchar* dst, size_t dststep, Size sz, int cn)
+{
+    fusedExpr_<float>(prog, proglen, src, srcstep, dst, dststep, sz, cn);
+}
+
+static void fusedExpr64f(const double* prog, int proglen, const uchar* const* src, const size_t* srcstep,
+                         uchar* dst, size_t dststep, Size sz, int cn)
+{
+    fusedExpr_<double>(prog, proglen, src, srcstep, dst, dststep, sz, cn);
+}
+
+FusedExprFunc getFusedExprFunc(int depth)
+{
+    return depth == CV_32F ? fusedExpr32f : depth == CV_64F ? fusedExpr64f : 0;
+}
+
+#endif
+
+CV_CPU_OPTIMIZATION_NAMESPACE_END
+} // namespace
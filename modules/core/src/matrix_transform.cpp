@@ -15,7 +15,7 @@ namespace cv {
 ////////////////////////////////////// transpose /////////////////////////////////////////
 
 template<typename T> static void
-transpose_( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz )
+transpose_( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz )
 {
     int i=0, j, m = sz.width, n = sz.height;
 
@@ -70,52 +70,151 @@ transpose_( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz )
     }
 }
 
-template<typename T> static void
-transposeI_( uchar* data, size_t step, int n )
+#if CV_SIMD128
+// Transposes a square block of nlanes x nlanes elements in registers:
+// log2(nlanes) rounds of interleaving the first half of the rows with the second half.
+// The lanes are only moved, so any 8-byte elements can be passed as v_float64x2.
+template<typename V> static inline void
+transposeBlock_( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep )
+{
+    typedef typename VTraits<V>::lane_type T;
+    enum { n = V::nlanes };
+    V r[n], t[n];
+    for( int k = 0; k < n; k++ )
+        r[k] = v_load((const T*)(src + sstep*k));
+    for( int s = 1; s < n; s *= 2 )
+    {
+        for( int k = 0; k < n/2; k++ )
+            v_zip(r[k], r[k + n/2], t[k*2], t[k*2 + 1]);
+        for( int k = 0; k < n; k++ )
+            r[k] = t[k];
+    }
+    for( int k = 0; k < n; k++ )
+        v_store((T*)(dst + dstep*k), r[k]);
+}
+
+template<typename T, typename V> static void
+transposeSIMD_( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz )
+{
+    enum { n = V::nlanes };
+    int m0 = sz.width & -n, n0 = sz.height & -n;
+#if CV_STRONG_ALIGNMENT
+    if( !isAligned<sizeof(typename VTraits<V>::lane_type)>(src, dst) ||
+        !isAligned<sizeof(typename VTraits<V>::lane_type)>((size_t)sstep | (size_t)dstep) )
+        m0 = n0 = 0;
+#endif
+    for( int i = 0; i < m0; i += n )
+        for( int j = 0; j < n0; j += n )
+            transposeBlock_<V>(src + i*sizeof(T) + sstep*j, sstep, dst + dstep*i + j*sizeof(T), dstep);
+    if( n0 < sz.height )
+        transpose_<T>(src + sstep*n0, sstep, dst + n0*sizeof(T), dstep, Size(m0, sz.height - n0));
+    if( m0 < sz.width )
+        transpose_<T>(src + m0*sizeof(T), sstep, dst + dstep*m0, dstep, Size(sz.width - m0, sz.height));
+}
+#endif
+
+// Any element size, used for the sizes which are not in the table below
+static void transposeGeneric( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz, size_t esz )
 {
-    for( int i = 0; i < n; i++ )
+    for( int i = 0; i < sz.width; i++ )
     {
-        T* row = (T*)(data + step*i);
-        uchar* data1 = data + i*sizeof(T);
-        for( int j = i+1; j < n; j++ )
-            std::swap( row[j], *(T*)(data1 + step*j) );
+        uchar* d = dst + dstep*i;
+        const uchar* s = src + i*esz;
+        for( int j = 0; j < sz.height; j++, d += esz, s += sstep )
+            memcpy(d, s, esz);
     }
 }
 
-typedef void (*TransposeFunc)( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz );
-typedef void (*TransposeInplaceFunc)( uchar* data, size_t step, int n );
+typedef void (*TransposeFunc)( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz, size_t esz );
+
+#if CV_SIMD128
+#define DEF_TRANSPOSE_SIMD_FUNC(suffix, type, vtype) \
+static void transpose_##suffix( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz, size_t ) \
+{ transposeSIMD_<type, vtype>(src, sstep, dst, dstep, sz); }
+#else
+#define DEF_TRANSPOSE_SIMD_FUNC(suffix, type, vtype) DEF_TRANSPOSE_FUNC(suffix, type)
+#endif
 
 #define DEF_TRANSPOSE_FUNC(suffix, type) \
-static void transpose_##suffix( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size sz ) \
-{ transpose_<type>(src, sstep, dst, dstep, sz); } \
-\
-static void transposeI_##suffix( uchar* data, size_t step, int n ) \
-{ transposeI_<type>(data, step, n); }
-
-DEF_TRANSPOSE_FUNC(8u, uchar)
-DEF_TRANSPOSE_FUNC(16u, ushort)
+static void transpose_##suffix( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz, size_t ) \
+{ transpose_<type>(src, sstep, dst, dstep, sz); }
+
+DEF_TRANSPOSE_SIMD_FUNC(8u, uchar, v_uint8x16)
+DEF_TRANSPOSE_SIMD_FUNC(16u, ushort, v_uint16x8)
 DEF_TRANSPOSE_FUNC(8uC3, Vec3b)
-DEF_TRANSPOSE_FUNC(32s, int)
+DEF_TRANSPOSE_SIMD_FUNC(32s, int, v_uint32x4)
 DEF_TRANSPOSE_FUNC(16uC3, Vec3s)
+#if CV_SIMD128_64F
+DEF_TRANSPOSE_SIMD_FUNC(32sC2, Vec2i, v_float64x2)
+#else
 DEF_TRANSPOSE_FUNC(32sC2, Vec2i)
+#endif
 DEF_TRANSPOSE_FUNC(32sC3, Vec3i)
 DEF_TRANSPOSE_FUNC(32sC4, Vec4i)
 DEF_TRANSPOSE_FUNC(32sC6, Vec6i)
 DEF_TRANSPOSE_FUNC(32sC8, Vec8i)
 
+#define TRANSPOSE_GEN transposeGeneric
+
 static TransposeFunc transposeTab[] =
 {
-    0, transpose_8u, transpose_16u, transpose_8uC3, transpose_32s, 0, transpose_16uC3, 0,
-    transpose_32sC2, 0, 0, 0, transpose_32sC3, 0, 0, 0, transpose_32sC4,
-    0, 0, 0, 0, 0, 0, 0, transpose_32sC6, 0, 0, 0, 0, 0, 0, 0, transpose_32sC8
+    0, transpose_8u, transpose_16u, transpose_8uC3, transpose_32s, TRANSPOSE_GEN, transpose_16uC3, TRANSPOSE_GEN,
+    transpose_32sC2, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, transpose_32sC3, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, transpose_32sC4,
+    TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, transpose_32sC6,
+    TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, TRANSPOSE_GEN, transpose_32sC8
 };
 
-static TransposeInplaceFunc transposeInplaceTab[] =
+#undef TRANSPOSE_GEN
+
+// Tiles are small enough to keep both the source and the destination rows of a tile in L1 cache
+static int getTransposeTileSize( size_t esz )
 {
-    0, transposeI_8u, transposeI_16u, transposeI_8uC3, transposeI_32s, 0, transposeI_16uC3, 0,
-    transposeI_32sC2, 0, 0, 0, transposeI_32sC3, 0, 0, 0, transposeI_32sC4,
-    0, 0, 0, 0, 0, 0, 0, transposeI_32sC6, 0, 0, 0, 0, 0, 0, 0, transposeI_32sC8
-};
+    return esz <= 2 ? 64 : esz <= 8 ? 32 : 16;
+}
+
+// Transposes sz (the source size) tile by tile, the destination rows are processed in parallel.
+// Negative steps flip the source or the destination vertically.
+static void transposeTiled( const uchar* src, ptrdiff_t sstep, uchar* dst, ptrdiff_t dstep, Size sz, size_t esz )
+{
+    TransposeFunc func = transposeTab[esz];
+    const int tile = getTransposeTileSize(esz);
+    parallel_for_(Range(0, (sz.width + tile - 1)/tile), [&](const Range& r)
+    {
+        for( int i0 = r.start*tile; i0 < std::min(r.end*tile, sz.width); i0 += tile )
+            for( int j0 = 0; j0 < sz.height; j0 += tile )
+                func(src + sstep*j0 + i0*esz, sstep, dst + dstep*i0 + j0*esz, dstep,
+                     Size(std::min(tile, sz.width - i0), std::min(tile, sz.height - j0)), esz);
+    }, (double)sz.area()*esz/(1 << 16));
+}
+
+// In-place transposition of a square matrix: the tiles (i, j) and (j, i) are exchanged through a buffer
+static void transposeInplaceTiled( uchar* data, size_t step, int n, size_t esz )
+{
+    TransposeFunc func = transposeTab[esz];
+    const int tile = getTransposeTileSize(esz);
+    const int ntiles = (n + tile - 1)/tile;
+    parallel_for_(Range(0, ntiles), [&](const Range& r)
+    {
+        AutoBuffer<uchar> _buf(tile*tile*esz);
+        uchar* buf = _buf.data();
+        const size_t bstep = tile*esz;
+        for( int ti = r.start; ti < r.end; ti++ )
+        {
+            int i0 = ti*tile, h = std::min(tile, n - i0);
+            for( int tj = ti; tj < ntiles; tj++ )
+            {
+                int j0 = tj*tile, w = std::min(tile, n - j0);
+                uchar* a = data + step*i0 + j0*esz;   // h x w
+                uchar* b = data + step*j0 + i0*esz;   // w x h
+                func(a, step, buf, bstep, Size(w, h), esz);
+                if( ti != tj )
+                    func(b, step, a, step, Size(h, w), esz);
+                for( int k = 0; k < w; k++ )
+                    memcpy(b + step*k, buf + bstep*k, h*esz);
+            }
+        }
+    }, (double)n*n*esz/(1 << 16));
+}
 
 #ifdef HAVE_OPENCL
 
@@ -275,17 +374,11 @@ void transpose( InputArray _src, OutputArray _dst )
 
     if( dst.data == src.data )
     {
-        TransposeInplaceFunc func = transposeInplaceTab[esz];
-        CV_Assert( func != 0 );
         CV_Assert( dst.cols == dst.rows );
-        func( dst.ptr(), dst.step, dst.rows );
+        transposeInplaceTiled( dst.ptr(), dst.step, dst.rows, esz );
     }
     else
-    {
-        TransposeFunc func = transposeTab[esz];
-        CV_Assert( func != 0 );
-        func( src.ptr(), src.step, dst.ptr(), dst.step, src.size() );
-    }
+        transposeTiled( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
 }
 
 
@@ -356,7 +449,7 @@ void transposeND(InputArray src_, const std::vector<int>& order, OutputArray dst
 
 
 #if CV_SIMD128
-template<typename V> CV_ALWAYS_INLINE void flipHoriz_single( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
+template<typename V> CV_ALWAYS_INLINE void flipHoriz_single( const uchar* src, ptrdiff_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
 {
     typedef typename VTraits<V>::lane_type T;
     int end = (int)(size.width*esz);
@@ -411,7 +504,7 @@ template<typename V> CV_ALWAYS_INLINE void flipHoriz_single( const uchar* src, s
     }
 }
 
-template<typename T1, typename T2> CV_ALWAYS_INLINE void flipHoriz_double( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
+template<typename T1, typename T2> CV_ALWAYS_INLINE void flipHoriz_double( const uchar* src, ptrdiff_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
 {
     int end = (int)(size.width*esz);
     int width = (end + 1)/2;
@@ -442,11 +535,11 @@ template<typename T1, typename T2> CV_ALWAYS_INLINE void flipHoriz_double( const
 #endif
 
 static void
-flipHoriz( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
+flipHoriz( const uchar* src, ptrdiff_t sstep, uchar* dst, size_t dstep, Size size, size_t esz )
 {
 #if CV_SIMD128
 #if CV_STRONG_ALIGNMENT
-    size_t alignmentMark = ((size_t)src)|((size_t)dst)|sstep|dstep;
+    size_t alignmentMark = ((size_t)src)|((size_t)dst)|(size_t)sstep|dstep;
 #endif
     if (esz == 2 * (size_t)VTraits<v_uint8x16>::vlanes())
     {
@@ -589,15 +682,18 @@ flipHoriz( const uchar* src, size_t sstep, uchar* dst, size_t dstep, Size size,
     }
 }
 
+// Swaps the rows y and size.height - 1 - y for y in [y0, y1), y1 <= (size.height + 1)/2
 static void
-flipVert( const uchar* src0, size_t sstep, uchar* dst0, size_t dstep, Size size, size_t esz )
+flipVert( const uchar* src0, size_t sstep, uchar* dst0, size_t dstep, Size size, size_t esz, int y0, int y1 )
 {
-    const uchar* src1 = src0 + (size.height - 1)*sstep;
-    uchar* dst1 = dst0 + (size.height - 1)*dstep;
+    const uchar* src1 = src0 + (size.height - 1 - y0)*sstep;
+    uchar* dst1 = dst0 + (size.height - 1 - y0)*dstep;
+    src0 += y0*sstep;
+    dst0 += y0*dstep;
     size.width *= (int)esz;
 
-    for( int y = 0; y < (size.height + 1)/2; y++, src0 += sstep, src1 -= sstep,
-                                                  dst0 += dstep, dst1 -= dstep )
+    for( int y = y0; y < y1; y++, src0 += sstep, src1 -= sstep,
+                                  dst0 += dstep, dst1 -= dstep )
     {
         int i = 0;
 #if (CV_SIMD || CV_SIMD_SCALABLE)
@@ -811,14 +907,28 @@ void flip( InputArray _src, OutputArray _dst, int flip_mode )
     CV_IPP_RUN_FAST(ipp_flip(src, dst, flip_mode));
 
     size_t esz = CV_ELEM_SIZE(type);
+    double nstripes = (double)size.area()*esz/(1 << 16);
 
-    if( flip_mode <= 0 )
-        flipVert( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
+    if( flip_mode == 0 || (flip_mode < 0 && src.data == dst.data) )
+    {
+        parallel_for_(Range(0, (size.height + 1)/2), [&](const Range& r)
+        {
+            flipVert( src.ptr(), src.step, dst.ptr(), dst.step, size, esz, r.start, r.end );
+        }, nstripes);
+        if( flip_mode < 0 )
+            flip( dst, dst, 1 );
+    }
     else
-        flipHoriz( src.ptr(), src.step, dst.ptr(), dst.step, src.size(), esz );
-
-    if( flip_mode < 0 )
-        flipHoriz( dst.ptr(), dst.step, dst.ptr(), dst.step, dst.size(), esz );
+    {
+        // both the flips in one pass: the source rows are read bottom-up
+        const uchar* sptr = flip_mode < 0 ? src.ptr(size.height - 1) : src.ptr();
+        ptrdiff_t sstep = flip_mode < 0 ? -(ptrdiff_t)src.step : (ptrdiff_t)src.step;
+        parallel_for_(Range(0, size.height), [&](const Range& r)
+        {
+            flipHoriz( sptr + sstep*r.start, sstep, dst.ptr(r.start), dst.step,
+                       Size(size.width, r.size()), esz );
+        }, nstripes);
+    }
 }
 
 static void
@@ -1144,6 +1254,17 @@ void rotate(InputArray _src, OutputArray _dst, int rotateMode)
     CALL_HAL(rotate90, cv_hal_rotate90, type, src.ptr(), src.step, src.cols, src.rows,
              dst.ptr(), dst.step, angle);
 
+    // a single pass: transposition of the source flipped vertically (90) or into the destination flipped vertically (270)
+    size_t esz = src.elemSize();
+    if( (angle == 90 || angle == 270) && dst.data != src.data && src.rows > 1 && src.cols > 1 && esz <= 32 )
+    {
+        if( angle == 90 )
+            transposeTiled( src.ptr(src.rows - 1), -(ptrdiff_t)src.step, dst.ptr(), dst.step, src.size(), esz );
+        else
+            transposeTiled( src.ptr(), src.step, dst.ptr(dst.rows - 1), -(ptrdiff_t)dst.step, src.size(), esz );
+        return;
+    }
+
     // use src (Mat) since _src (InputArray) is updated by _dst.create() when in-place
     rotateImpl(src, _dst, rotateMode);
 }
@@ -122,18 +122,9 @@ static bool ipp_mean( Mat &src, Mat &mask, Scalar &ret )
 }
 #endif
 
-Scalar mean(InputArray _src, InputArray _mask)
+static size_t mean_(const Mat& src, const Mat& mask, Scalar& s)
 {
-    CV_INSTRUMENT_REGION();
-
-    Mat src = _src.getMat(), mask = _mask.getMat();
-    CV_Assert( mask.empty() || mask.type() == CV_8U );
-
     int k, cn = src.channels(), depth = src.depth();
-    Scalar s;
-
-    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_mean(src, mask, s), s)
-
     SumFunc func = getSumFunc(depth);
 
     CV_Assert( cn <= 4 && func != 0 );
@@ -182,6 +173,40 @@ Scalar mean(InputArray _src, InputArray _mask)
                 ptrs[1] += bsz;
         }
     }
+    return nz0;
+}
+
+Scalar mean(InputArray _src, InputArray _mask)
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat src = _src.getMat(), mask = _mask.getMat();
+    CV_Assert( mask.empty() || mask.type() == CV_8U );
+
+    Scalar s;
+
+    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_mean(src, mask, s), s)
+
+    size_t nz0 = 0;
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        CV_Assert( mask.empty() || mask.size == src.size );
+        typedef std::pair<Scalar, size_t> Partial;
+        Partial res = parallelReduce<Partial>(src.size(), nstripes,
+            [&](const Rect& r)
+            {
+                Partial p;
+                p.second = mean_(src(r), mask.empty() ? mask : mask(r), p.first);
+                return p;
+            },
+            [](const Partial& a, const Partial& b) { return Partial(a.first + b.first, a.second + b.second); });
+        s = res.first;
+        nz0 = res.second;
+    }
+    else
+        nz0 = mean_(src, mask, s);
+
     return s*(nz0 ? 1./nz0 : 0);
 }
 
@@ -513,6 +538,79 @@ static bool ipp_meanStdDev(Mat& src, OutputArray _mean, OutputArray _sdv, Mat& m
 }
 #endif
 
+// Sums of the channels and sums of their squares under the mask, returns the number of pixels
+static int meanStdDev_(const Mat& src, const Mat& mask, double* sum, double* sqsum)
+{
+    int k, cn = src.channels(), depth = src.depth();
+    SumSqrFunc func = getSumSqrFunc(depth);
+
+    CV_Assert( func != 0 );
+
+    const Mat* arrays[] = {&src, &mask, 0};
+    uchar* ptrs[2] = {};
+    NAryMatIterator it(arrays, ptrs);
+    int total = (int)it.size, blockSize = total, intSumBlockSize = 0;
+    int j, count = 0, nz0 = 0;
+    AutoBuffer<double> _buf(cn*4);
+    double *s = (double*)_buf.data(), *sq = s + cn;
+    int *sbuf = (int*)s, *sqbuf = (int*)sq;
+    bool blockSum = depth <= CV_16S, blockSqSum = depth <= CV_8S;
+    size_t esz = 0;
+
+    for( k = 0; k < cn; k++ )
+        s[k] = sq[k] = 0;
+
+    if( blockSum )
+    {
+        intSumBlockSize = 1 << 15;
+        blockSize = std::min(blockSize, intSumBlockSize);
+        sbuf = (int*)(sq + cn);
+        if( blockSqSum )
+            sqbuf = sbuf + cn;
+        for( k = 0; k < cn; k++ )
+            sbuf[k] = sqbuf[k] = 0;
+        esz = src.elemSize();
+    }
+
+    for( size_t i = 0; i < it.nplanes; i++, ++it )
+    {
+        for( j = 0; j < total; j += blockSize )
+        {
+            int bsz = std::min(total - j, blockSize);
+            int nz = func( ptrs[0], ptrs[1], (uchar*)sbuf, (uchar*)sqbuf, bsz, cn );
+            count += nz;
+            nz0 += nz;
+            if( blockSum && (count + blockSize >= intSumBlockSize || (i+1 >= it.nplanes && j+bsz >= total)) )
+            {
+                for( k = 0; k < cn; k++ )
+                {
+                    s[k] += sbuf[k];
+                    sbuf[k] = 0;
+                }
+                if( blockSqSum )
+                {
+                    for( k = 0; k < cn; k++ )
+                    {
+                        sq[k] += sqbuf[k];
+                        sqbuf[k] = 0;
+                    }
+                }
+                count = 0;
+            }
+            ptrs[0] += bsz*esz;
+            if( ptrs[1] )
+                ptrs[1] += bsz;
+        }
+    }
+
+    for( k = 0; k < cn; k++ )
+    {
+        sum[k] = s[k];
+        sqsum[k] = sq[k];
+    }
+    return nz0;
+}
+
 void meanStdDev(InputArray _src, OutputArray _mean, OutputArray _sdv, InputArray _mask)
 {
     CV_INSTRUMENT_REGION();
@@ -532,7 +630,7 @@ void meanStdDev(InputArray _src, OutputArray _mean, OutputArray _sdv, InputArray
 
     CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_meanStdDev(src, _mean, _sdv, mask));
 
-    int k, cn = src.channels(), depth = src.depth();
+    int k, cn = src.channels();
     Mat mean_mat, stddev_mat;
 
     if(_mean.needed())
@@ -575,66 +673,32 @@ void meanStdDev(InputArray _src, OutputArray _mean, OutputArray _sdv, InputArray
         }
     }
 
-    SumSqrFunc func = getSumSqrFunc(depth);
-
-    CV_Assert( func != 0 );
-
-    const Mat* arrays[] = {&src, &mask, 0};
-    uchar* ptrs[2] = {};
-    NAryMatIterator it(arrays, ptrs);
-    int total = (int)it.size, blockSize = total, intSumBlockSize = 0;
-    int j, count = 0, nz0 = 0;
-    AutoBuffer<double> _buf(cn*4);
-    double *s = (double*)_buf.data(), *sq = s + cn;
-    int *sbuf = (int*)s, *sqbuf = (int*)sq;
-    bool blockSum = depth <= CV_16S, blockSqSum = depth <= CV_8S;
-    size_t esz = 0;
-
-    for( k = 0; k < cn; k++ )
-        s[k] = sq[k] = 0;
-
-    if( blockSum )
-    {
-        intSumBlockSize = 1 << 15;
-        blockSize = std::min(blockSize, intSumBlockSize);
-        sbuf = (int*)(sq + cn);
-        if( blockSqSum )
-            sqbuf = sbuf + cn;
-        for( k = 0; k < cn; k++ )
-            sbuf[k] = sqbuf[k] = 0;
-        esz = src.elemSize();
-    }
-
-    for( size_t i = 0; i < it.nplanes; i++, ++it )
+    AutoBuffer<double> _buf(cn*2);
+    double *s = _buf.data(), *sq = s + cn;
+    int nz0 = 0;
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
     {
-        for( j = 0; j < total; j += blockSize )
-        {
-            int bsz = std::min(total - j, blockSize);
-            int nz = func( ptrs[0], ptrs[1], (uchar*)sbuf, (uchar*)sqbuf, bsz, cn );
-            count += nz;
-            nz0 += nz;
-            if( blockSum && (count + blockSize >= intSumBlockSize || (i+1 >= it.nplanes && j+bsz >= total)) )
+        // the sums of the channels, the sums of squares and the number of pixels
+        std::vector<double> res = parallelReduce<std::vector<double> >(src.size(), nstripes,
+            [&](const Rect& r)
             {
-                for( k = 0; k < cn; k++ )
-                {
-                    s[k] += sbuf[k];
-                    sbuf[k] = 0;
-                }
-                if( blockSqSum )
-                {
-                    for( k = 0; k < cn; k++ )
-                    {
-                        sq[k] += sqbuf[k];
-                        sqbuf[k] = 0;
-                    }
-                }
-                count = 0;
-            }
-            ptrs[0] += bsz*esz;
-            if( ptrs[1] )
-                ptrs[1] += bsz;
-        }
+                std::vector<double> p(cn*2 + 1);
+                p[cn*2] = meanStdDev_(src(r), mask.empty() ? mask : mask(r), &p[0], &p[cn]);
+                return p;
+            },
+            [](const std::vector<double>& x, const std::vector<double>& y)
+            {
+                std::vector<double> p(x);
+                for (size_t i = 0; i < p.size(); i++)
+                    p[i] += y[i];
+                return p;
+            });
+        std::copy(res.begin(), res.end() - 1, s);
+        nz0 = (int)res.back();
     }
+    else
+        nz0 = meanStdDev_(src, mask, s, sq);
 
     double scale = nz0 ? 1./nz0 : 0.;
     for( k = 0; k < cn; k++ )
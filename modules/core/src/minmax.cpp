@@ -866,6 +866,58 @@ static void ofs2idx(const Mat& a, size_t ofs, int* idx)
     }
 }
 
+// Extremums of the array and their 1-based offsets (0 if no pixel is scanned)
+struct MinMaxIdxRes
+{
+    double minVal, maxVal;
+    size_t minidx, maxidx;
+};
+
+static MinMaxIdxRes minMaxIdx_(const Mat& src, const Mat& mask)
+{
+    int depth = src.depth(), cn = src.channels();
+    MinMaxIdxFunc func = getMinmaxTab(depth);
+    CV_Assert( func != 0 );
+
+    const Mat* arrays[] = {&src, &mask, 0};
+    uchar* ptrs[2] = {};
+    NAryMatIterator it(arrays, ptrs);
+
+    size_t minidx = 0, maxidx = 0;
+    int iminval = INT_MAX, imaxval = INT_MIN;
+    float  fminval = std::numeric_limits<float>::infinity(),  fmaxval = -fminval;
+    double dminval = std::numeric_limits<double>::infinity(), dmaxval = -dminval;
+    size_t startidx = 1;
+    int *minval = &iminval, *maxval = &imaxval;
+    int planeSize = (int)it.size*cn;
+
+    if( depth == CV_32F )
+        minval = (int*)&fminval, maxval = (int*)&fmaxval;
+    else if( depth == CV_64F )
+        minval = (int*)&dminval, maxval = (int*)&dmaxval;
+
+    for( size_t i = 0; i < it.nplanes; i++, ++it, startidx += planeSize )
+        func( ptrs[0], ptrs[1], minval, maxval, &minidx, &maxidx, planeSize, startidx );
+
+    if( depth == CV_32F )
+        dminval = fminval, dmaxval = fmaxval;
+    else if( depth <= CV_32S )
+        dminval = iminval, dmaxval = imaxval;
+
+    MinMaxIdxRes res = { dminval, dmaxval, minidx, maxidx };
+    return res;
+}
+
+// Converts the offset within the stripe of a 2D array to the offset within the whole array
+static size_t stripeOfs2ofs(size_t ofs, const Rect& stripe, int cols, int cn)
+{
+    if( ofs == 0 )
+        return 0;
+    size_t pix = (ofs - 1) / cn, ch = (ofs - 1) % cn;
+    size_t y = stripe.y + pix / stripe.width, x = stripe.x + pix % stripe.width;
+    return (y*cols + x)*cn + ch + 1;
+}
+
 #ifdef HAVE_OPENCL
 
 #define MINMAX_STRUCT_ALIGNMENT 8 // sizeof double
@@ -1501,7 +1553,7 @@ void cv::minMaxIdx(InputArray _src, double* minVal,
 {
     CV_INSTRUMENT_REGION();
 
-    int type = _src.type(), depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    int type = _src.type(), cn = CV_MAT_CN(type);
     CV_Assert( (cn == 1 && (_mask.empty() || _mask.type() == CV_8U)) ||
         (cn > 1 && _mask.empty() && !minIdx && !maxIdx) );
 
@@ -1540,28 +1592,35 @@ void cv::minMaxIdx(InputArray _src, double* minVal,
 
     CV_IPP_RUN_FAST(ipp_minMaxIdx(src, minVal, maxVal, minIdx, maxIdx, mask))
 
-    MinMaxIdxFunc func = getMinmaxTab(depth);
-    CV_Assert( func != 0 );
-
-    const Mat* arrays[] = {&src, &mask, 0};
-    uchar* ptrs[2] = {};
-    NAryMatIterator it(arrays, ptrs);
-
-    size_t minidx = 0, maxidx = 0;
-    int iminval = INT_MAX, imaxval = INT_MIN;
-    float  fminval = std::numeric_limits<float>::infinity(),  fmaxval = -fminval;
-    double dminval = std::numeric_limits<double>::infinity(), dmaxval = -dminval;
-    size_t startidx = 1;
-    int *minval = &iminval, *maxval = &imaxval;
-    int planeSize = (int)it.size*cn;
-
-    if( depth == CV_32F )
-        minval = (int*)&fminval, maxval = (int*)&fmaxval;
-    else if( depth == CV_64F )
-        minval = (int*)&dminval, maxval = (int*)&dmaxval;
+    MinMaxIdxRes res;
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        CV_Assert( mask.empty() || mask.size == src.size );
+        // ties are resolved by the offset, so the first occurrence is reported as in the serial scan
+        res = parallelReduce<MinMaxIdxRes>(src.size(), nstripes,
+            [&](const Rect& r)
+            {
+                MinMaxIdxRes p = minMaxIdx_(src(r), mask.empty() ? mask : mask(r));
+                p.minidx = stripeOfs2ofs(p.minidx, r, src.cols, cn);
+                p.maxidx = stripeOfs2ofs(p.maxidx, r, src.cols, cn);
+                return p;
+            },
+            [](const MinMaxIdxRes& x, const MinMaxIdxRes& y)
+            {
+                MinMaxIdxRes p = x;
+                if( y.minidx != 0 && (x.minidx == 0 || y.minVal < x.minVal || (y.minVal == x.minVal && y.minidx < x.minidx)) )
+                    p.minVal = y.minVal, p.minidx = y.minidx;
+                if( y.maxidx != 0 && (x.maxidx == 0 || y.maxVal > x.maxVal || (y.maxVal == x.maxVal && y.maxidx < x.maxidx)) )
+                    p.maxVal = y.maxVal, p.maxidx = y.maxidx;
+                return p;
+            });
+    }
+    else
+        res = minMaxIdx_(src, mask);
 
-    for( size_t i = 0; i < it.nplanes; i++, ++it, startidx += planeSize )
-        func( ptrs[0], ptrs[1], minval, maxval, &minidx, &maxidx, planeSize, startidx );
+    size_t minidx = res.minidx, maxidx = res.maxidx;
+    double dminval = res.minVal, dmaxval = res.maxVal;
 
     if (!src.empty() && mask.empty())
     {
@@ -1573,10 +1632,6 @@ void cv::minMaxIdx(InputArray _src, double* minVal,
 
     if( minidx == 0 )
         dminval = dmaxval = 0;
-    else if( depth == CV_32F )
-        dminval = fminval, dmaxval = fmaxval;
-    else if( depth <= CV_32S )
-        dminval = iminval, dmaxval = imaxval;
 
     if( minVal )
         *minVal = dminval;
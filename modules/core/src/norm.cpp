@@ -600,28 +600,8 @@ static bool ipp_norm(Mat &src, int normType, Mat &mask, double &result)
 }  // ipp_norm()
 #endif  // HAVE_IPP
 
-double norm( InputArray _src, int normType, InputArray _mask )
+static double norm_(const Mat& src, int normType, const Mat& mask)
 {
-    CV_INSTRUMENT_REGION();
-
-    normType &= NORM_TYPE_MASK;
-    CV_Assert( normType == NORM_INF || normType == NORM_L1 ||
-               normType == NORM_L2 || normType == NORM_L2SQR ||
-               ((normType == NORM_HAMMING || normType == NORM_HAMMING2) && _src.type() == CV_8U) );
-
-#if defined HAVE_OPENCL || defined HAVE_IPP
-    double _result = 0;
-#endif
-
-#ifdef HAVE_OPENCL
-    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src.isUMat()) && _src.dims() <= 2,
-                ocl_norm(_src, normType, _mask, _result),
-                _result)
-#endif
-
-    Mat src = _src.getMat(), mask = _mask.getMat();
-    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_norm(src, normType, mask, _result), _result);
-
     int depth = src.depth(), cn = src.channels();
     if( src.isContinuous() && mask.empty() )
     {
@@ -790,6 +770,42 @@ double norm( InputArray _src, int normType, InputArray _mask )
     return result.d;
 }
 
+double norm( InputArray _src, int normType, InputArray _mask )
+{
+    CV_INSTRUMENT_REGION();
+
+    normType &= NORM_TYPE_MASK;
+    CV_Assert( normType == NORM_INF || normType == NORM_L1 ||
+               normType == NORM_L2 || normType == NORM_L2SQR ||
+               ((normType == NORM_HAMMING || normType == NORM_HAMMING2) && _src.type() == CV_8U) );
+
+#if defined HAVE_OPENCL || defined HAVE_IPP
+    double _result = 0;
+#endif
+
+#ifdef HAVE_OPENCL
+    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src.isUMat()) && _src.dims() <= 2,
+                ocl_norm(_src, normType, _mask, _result),
+                _result)
+#endif
+
+    Mat src = _src.getMat(), mask = _mask.getMat();
+    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_norm(src, normType, mask, _result), _result);
+
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        CV_Assert( mask.empty() || mask.size == src.size );
+        // L2 norm is the square root of the sum of the partial L2SQR norms
+        int stripeNormType = normType == NORM_L2 ? NORM_L2SQR : normType;
+        double result = parallelReduce<double>(src.size(), nstripes,
+            [&](const Rect& r) { return norm_(src(r), stripeNormType, mask.empty() ? mask : mask(r)); },
+            [&](double x, double y) { return normType == NORM_INF ? std::max(x, y) : x + y; });
+        return normType == NORM_L2 ? std::sqrt(result) : result;
+    }
+    return norm_(src, normType, mask);
+}
+
 //==================================================================================================
 
 #ifdef HAVE_OPENCL
@@ -1070,38 +1086,10 @@ static bool ipp_norm(InputArray _src1, InputArray _src2, int normType, InputArra
 #endif  // HAVE_IPP
 
 
-double norm( InputArray _src1, InputArray _src2, int normType, InputArray _mask )
+static double norm_(const Mat& src1, const Mat& src2, int normType, const Mat& mask)
 {
-    CV_INSTRUMENT_REGION();
-
-    CV_CheckTypeEQ(_src1.type(), _src2.type(), "Input type mismatch");
-    CV_Assert(_src1.sameSize(_src2));
-
-#if defined HAVE_OPENCL || defined HAVE_IPP
-    double _result = 0;
-#endif
-
-#ifdef HAVE_OPENCL
-    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src1.isUMat()),
-                ocl_norm(_src1, _src2, normType, _mask, _result),
-                _result)
-#endif
-
-    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_norm(_src1, _src2, normType, _mask, _result), _result);
-
-    if( normType & CV_RELATIVE )
-    {
-        return norm(_src1, _src2, normType & ~CV_RELATIVE, _mask)/(norm(_src2, normType, _mask) + DBL_EPSILON);
-    }
-
-    Mat src1 = _src1.getMat(), src2 = _src2.getMat(), mask = _mask.getMat();
     int depth = src1.depth(), cn = src1.channels();
 
-    normType &= 7;
-    CV_Assert( normType == NORM_INF || normType == NORM_L1 ||
-               normType == NORM_L2 || normType == NORM_L2SQR ||
-              ((normType == NORM_HAMMING || normType == NORM_HAMMING2) && src1.type() == CV_8U) );
-
     if( src1.isContinuous() && src2.isContinuous() && mask.empty() )
     {
         size_t len = src1.total()*src1.channels();
@@ -1262,6 +1250,50 @@ double norm( InputArray _src1, InputArray _src2, int normType, InputArray _mask
     return result.d;
 }
 
+double norm( InputArray _src1, InputArray _src2, int normType, InputArray _mask )
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_CheckTypeEQ(_src1.type(), _src2.type(), "Input type mismatch");
+    CV_Assert(_src1.sameSize(_src2));
+
+#if defined HAVE_OPENCL || defined HAVE_IPP
+    double _result = 0;
+#endif
+
+#ifdef HAVE_OPENCL
+    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src1.isUMat()),
+                ocl_norm(_src1, _src2, normType, _mask, _result),
+                _result)
+#endif
+
+    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_norm(_src1, _src2, normType, _mask, _result), _result);
+
+    if( normType & CV_RELATIVE )
+    {
+        return norm(_src1, _src2, normType & ~CV_RELATIVE, _mask)/(norm(_src2, normType, _mask) + DBL_EPSILON);
+    }
+
+    Mat src1 = _src1.getMat(), src2 = _src2.getMat(), mask = _mask.getMat();
+
+    normType &= 7;
+    CV_Assert( normType == NORM_INF || normType == NORM_L1 ||
+               normType == NORM_L2 || normType == NORM_L2SQR ||
+              ((normType == NORM_HAMMING || normType == NORM_HAMMING2) && src1.type() == CV_8U) );
+
+    int nstripes = src1.dims <= 2 ? getReduceStripes(src1.size(), src1.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        CV_Assert( mask.empty() || mask.size == src1.size );
+        int stripeNormType = normType == NORM_L2 ? NORM_L2SQR : normType;
+        double result = parallelReduce<double>(src1.size(), nstripes,
+            [&](const Rect& r) { return norm_(src1(r), src2(r), stripeNormType, mask.empty() ? mask : mask(r)); },
+            [&](double x, double y) { return normType == NORM_INF ? std::max(x, y) : x + y; });
+        return normType == NORM_L2 ? std::sqrt(result) : result;
+    }
+    return norm_(src1, src2, normType, mask);
+}
+
 cv::Hamming::ResultType Hamming::operator()( const unsigned char* a, const unsigned char* b, int size ) const
 {
     return cv::hal::normHamming(a, b, size);
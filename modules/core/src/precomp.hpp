@@ -278,6 +278,12 @@ Size getContinuousSize2D(Mat& m1, int widthScale=1);
 Size getContinuousSize2D(Mat& m1, Mat& m2, int widthScale=1);
 Size getContinuousSize2D(Mat& m1, Mat& m2, Mat& m3, int widthScale=1);
 
+// Runs an element-wise operation over the array of size sz (as returned by getContinuousSize2D),
+// in parallel if the array is large enough. body processes the given part of the array,
+// long rows are split along the width. bytesPerUnit is the number of bytes read and written
+// per unit of the width.
+void parallelForElemwise(Size sz, size_t bytesPerUnit, const std::function<void(const Rect&)>& body);
+
 void setSize( Mat& m, int _dims, const int* _sz, const size_t* _steps, bool autoSteps=false );
 void finalizeHdr(Mat& m);
 int updateContinuityFlag(int flags, int dims, const int* size, const size_t* step);
@@ -7,6 +7,7 @@
 #define SRC_STAT_HPP
 
 #include "opencv2/core/mat.hpp"
+#include "opencv2/core/utility.hpp"
 
 namespace cv {
 
@@ -38,6 +39,32 @@ template <typename T> Scalar ocl_part_sum(Mat m)
 typedef int (*SumFunc)(const uchar*, const uchar* mask, uchar*, int, int);
 SumFunc getSumFunc(int depth);
 
+// Deterministic parallel reductions.
+// Large 2D arrays are split into stripes which depend on the array size and element size only,
+// the partial results of the stripes are combined pairwise in a fixed order. So the result
+// doesn't depend on the number of threads (it may differ from the serial one in the last bits).
+
+// Number of stripes for the array of the given size, 1 means the array is too small to be split
+int getReduceStripes(Size sz, size_t esz);
+// Part of the array processed by the given stripe: a range of rows, or a range of columns
+// if there are fewer rows than stripes
+Rect getReduceStripe(Size sz, int nstripes, int stripe);
+
+template<typename T, typename Body, typename Combine>
+T parallelReduce(Size sz, int nstripes, const Body& body, const Combine& combine)
+{
+    std::vector<T> partial(nstripes);
+    parallel_for_(Range(0, nstripes), [&](const Range& range)
+    {
+        for (int i = range.start; i < range.end; i++)
+            partial[i] = body(getReduceStripe(sz, nstripes, i));
+    }, nstripes);
+    for (int step = 1; step < nstripes; step *= 2)
+        for (int i = 0; i + step < nstripes; i += step*2)
+            partial[i] = combine(partial[i], partial[i + step]);
+    return partial[0];
+}
+
 }
 
 #endif // SRC_STAT_HPP
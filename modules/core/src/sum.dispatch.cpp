@@ -28,6 +28,31 @@ SumFunc getSumFunc(int depth)
         CV_CPU_DISPATCH_MODES_ALL);
 }
 
+// Arrays below 4MB are processed in one piece, larger ones in stripes of about 1MB
+enum { REDUCE_PARALLEL_MIN_BYTES = 4 << 20, REDUCE_STRIPE_BYTES = 1 << 20 };
+
+int getReduceStripes(Size sz, size_t esz)
+{
+    size_t bytes = (size_t)sz.width*sz.height*esz;
+    if (bytes < REDUCE_PARALLEL_MIN_BYTES)
+        return 1;
+    size_t nstripes = bytes / REDUCE_STRIPE_BYTES;
+    if ((size_t)sz.height < nstripes)
+        nstripes = std::min(nstripes, (size_t)sz.width);
+    return (int)std::min(nstripes, (size_t)INT_MAX);
+}
+
+Rect getReduceStripe(Size sz, int nstripes, int stripe)
+{
+    if (sz.height >= nstripes)
+    {
+        int y0 = (int)((int64)sz.height*stripe/nstripes), y1 = (int)((int64)sz.height*(stripe + 1)/nstripes);
+        return Rect(0, y0, sz.width, y1 - y0);
+    }
+    int x0 = (int)((int64)sz.width*stripe/nstripes), x1 = (int)((int64)sz.width*(stripe + 1)/nstripes);
+    return Rect(x0, 0, x1 - x0, sz.height);
+}
+
 #ifdef HAVE_OPENCL
 
 bool ocl_sum( InputArray _src, Scalar & res, int sum_op, InputArray _mask,
@@ -181,23 +206,8 @@ static bool ipp_sum(Mat &src, Scalar &_res)
 }
 #endif
 
-Scalar sum(InputArray _src)
+static Scalar sum_(const Mat& src)
 {
-    CV_INSTRUMENT_REGION();
-
-#if defined HAVE_OPENCL || defined HAVE_IPP
-    Scalar _res;
-#endif
-
-#ifdef HAVE_OPENCL
-    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src.isUMat()) && _src.dims() <= 2,
-                ocl_sum(_src, _res, OCL_OP_SUM),
-                _res)
-#endif
-
-    Mat src = _src.getMat();
-    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_sum(src, _res), _res);
-
     int k, cn = src.channels(), depth = src.depth();
     SumFunc func = getSumFunc(depth);
     CV_Assert( cn <= 4 && func != 0 );
@@ -247,4 +257,31 @@ Scalar sum(InputArray _src)
     return s;
 }
 
+Scalar sum(InputArray _src)
+{
+    CV_INSTRUMENT_REGION();
+
+#if defined HAVE_OPENCL || defined HAVE_IPP
+    Scalar _res;
+#endif
+
+#ifdef HAVE_OPENCL
+    CV_OCL_RUN_(OCL_PERFORMANCE_CHECK(_src.isUMat()) && _src.dims() <= 2,
+                ocl_sum(_src, _res, OCL_OP_SUM),
+                _res)
+#endif
+
+    Mat src = _src.getMat();
+    CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_sum(src, _res), _res);
+
+    int nstripes = src.dims <= 2 ? getReduceStripes(src.size(), src.elemSize()) : 1;
+    if (nstripes > 1)
+    {
+        return parallelReduce<Scalar>(src.size(), nstripes,
+            [&](const Rect& r) { return sum_(src(r)); },
+            [](const Scalar& a, const Scalar& b) { return a + b; });
+    }
+    return sum_(src);
+}
+
 } // namespace
@@ -2316,6 +2316,57 @@ INSTANTIATE_TEST_CASE_P(Arithm, FlipND, testing::Combine(
     testing::Values(perf::MatType(CV_8UC1), CV_32FC1)
 ));
 
+// tiled and multi-threaded transpose, flip, rotate and repeat for all the element sizes
+typedef testing::TestWithParam<int> Core_Transform_AllElemSizes;
+
+TEST_P(Core_Transform_AllElemSizes, accuracy)
+{
+    const int esz = GetParam();
+    RNG& rng = theRNG();
+    const Size sizes[] = { Size(131, 67), Size(300, 300), Size(1, 40), Size(250, 1) };
+    for (const Size& sz : sizes)
+    {
+        SCOPED_TRACE(cv::format("%dx%d", sz.width, sz.height));
+        Mat src(sz, CV_8UC(esz)), dst, ref;
+        rng.fill(src, RNG::UNIFORM, 0, 256);
+
+        cv::transpose(src, dst);
+        cvtest::transpose(src, ref);
+        EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+        if (sz.width == sz.height)
+        {
+            dst = src.clone();
+            cv::transpose(dst, dst);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF));
+        }
+
+        for (int code = -1; code <= 1; code++)
+        {
+            cv::flip(src, dst, code);
+            reference::flip(src, ref, code);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "flip " << code;
+            dst = src.clone();
+            cv::flip(dst, dst, code);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "in-place flip " << code;
+        }
+
+        for (int code = 0; code < 3; code++)
+        {
+            cv::rotate(src, dst, code);
+            reference::rotate(src, ref, code);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "rotate " << code;
+        }
+
+        cv::repeat(src, 3, 5, dst);
+        ASSERT_EQ(Size(sz.width*5, sz.height*3), dst.size());
+        for (int y = 0; y < 3; y++)
+            for (int x = 0; x < 5; x++)
+                EXPECT_EQ(0, cvtest::norm(src, dst(Rect(x*sz.width, y*sz.height, sz.width, sz.height)), NORM_INF));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_Transform_AllElemSizes, testing::Range(1, 33));
+
 TEST(BroadcastTo, basic) {
     std::vector<int> shape_src{2, 1};
     std::vector<int> data_src{1, 2};
@@ -3070,5 +3121,146 @@ INSTANTIATE_TEST_CASE_P(Core_CartPolar, Core_PolarToCart_inplace,
     )
 );
 
+typedef testing::TestWithParam<Size> Core_Elemwise_Parallel;
+
+// Large arrays are split into stripes, the results must match the single-threaded ones
+TEST_P(Core_Elemwise_Parallel, regression)
+{
+    const Size sz = GetParam();
+    Mat src_a(sz.height + 2, sz.width + 2, CV_32FC3), src_b(sz.height + 2, sz.width + 2, CV_32FC3);
+    randu(src_a, -100, 100);
+    randu(src_b, -100, 100);
+    // continuous arrays and ROIs
+    std::vector<std::pair<Mat, Mat> > inputs = {
+        { src_a.reshape(0, 1).colRange(0, sz.area()).reshape(0, sz.height), src_b.reshape(0, 1).colRange(0, sz.area()).reshape(0, sz.height) },
+        { src_a(Rect(1, 1, sz.width, sz.height)), src_b(Rect(1, 1, sz.width, sz.height)) }
+    };
+
+    std::vector<std::function<void(const Mat&, const Mat&, Mat&)> > ops = {
+        [](const Mat& a, const Mat& b, Mat& d) { cv::add(a, b, d); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::absdiff(a, b, d); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::multiply(a, b, d, 0.5); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::divide(a, b, d); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::addWeighted(a, 0.3, b, 0.7, 1., d); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::compare(a, b, d, CMP_LE); },
+        [](const Mat& a, const Mat&  , Mat& d) { cv::inRange(a, Scalar(-50, -10, 0), Scalar(50, 10, 100), d); },
+        [](const Mat& a, const Mat& b, Mat& d) { cv::inRange(a, b, b + 50, d); },
+        [](const Mat& a, const Mat&  , Mat& d) { a.convertTo(d, CV_16S, 2., 3.); },
+        [](const Mat& a, const Mat&  , Mat& d) { cv::convertScaleAbs(a, d, 2., 3.); }
+    };
+
+    const int threads = cv::getNumThreads();
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        const Mat& a = inputs[i].first, &b = inputs[i].second;
+        for (size_t k = 0; k < ops.size(); k++)
+        {
+            Mat ref, dst;
+            cv::setNumThreads(1);
+            ops[k](a, b, ref);
+            cv::setNumThreads(4);
+            ops[k](a, b, dst);
+            cv::setNumThreads(threads);
+            EXPECT_EQ(0, cvtest::norm(ref, dst, NORM_INF)) << "input " << i << ", operation " << k;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_Elemwise_Parallel, testing::Values(Size(1000, 600), Size(600000, 1), Size(1, 600000)));
+
+typedef testing::TestWithParam<tuple<Size, int> > Core_Reduce_Parallel;
+
+// Large arrays are reduced in stripes, the results must not depend on the number of threads
+TEST_P(Core_Reduce_Parallel, accuracy)
+{
+    const Size sz = get<0>(GetParam());
+    const int type = get<1>(GetParam()), cn = CV_MAT_CN(type);
+    Mat src(sz, type), src2(sz, type), mask(sz, CV_8UC1);
+    randu(src, 0, 100);
+    randu(src2, 0, 100);
+    randu(mask, 0, 2);
+
+    auto compute = [&]()
+    {
+        std::vector<double> res;
+        Scalar s = cv::sum(src), m = cv::mean(src), mm = cv::mean(src, mask);
+        res.insert(res.end(), s.val, s.val + 4);
+        res.insert(res.end(), m.val, m.val + 4);
+        res.insert(res.end(), mm.val, mm.val + 4);
+        Mat mu, sigma;
+        cv::meanStdDev(src, mu, sigma);
+        res.insert(res.end(), mu.begin<double>(), mu.end<double>());
+        res.insert(res.end(), sigma.begin<double>(), sigma.end<double>());
+        cv::meanStdDev(src, mu, sigma, mask);
+        res.insert(res.end(), mu.begin<double>(), mu.end<double>());
+        res.insert(res.end(), sigma.begin<double>(), sigma.end<double>());
+        const int normTypes[] = { NORM_INF, NORM_L1, NORM_L2, NORM_L2SQR };
+        for (int normType : normTypes)
+        {
+            res.push_back(cv::norm(src, normType));
+            res.push_back(cv::norm(src, normType, mask));
+            res.push_back(cv::norm(src, src2, normType));
+            res.push_back(cv::norm(src, src2, normType, mask));
+        }
+        res.push_back(cv::countNonZero(mask));
+        double minVal = 0, maxVal = 0;
+        cv::minMaxIdx(src, &minVal, &maxVal);
+        res.push_back(minVal);
+        res.push_back(maxVal);
+        if (cn == 1)
+        {
+            Point minLoc, maxLoc;
+            cv::minMaxLoc(src, &minVal, &maxVal, &minLoc, &maxLoc, mask);
+            res.insert(res.end(), { minVal, maxVal, (double)minLoc.x, (double)minLoc.y, (double)maxLoc.x, (double)maxLoc.y });
+        }
+        return res;
+    };
+
+    const int threads = cv::getNumThreads();
+    cv::setNumThreads(1);
+    std::vector<double> ref = compute();
+    for (int nthreads = 2; nthreads <= 4; nthreads++)
+    {
+        cv::setNumThreads(nthreads);
+        EXPECT_EQ(ref, compute()) << "threads: " << nthreads;
+    }
+    cv::setNumThreads(threads);
+
+    Scalar m = cvtest::mean(src), mm = cvtest::mean(src, mask);
+    for (int c = 0; c < cn; c++)
+    {
+        EXPECT_NEAR(m[c], cv::mean(src)[c], 1e-6);
+        EXPECT_NEAR(mm[c], cv::mean(src, mask)[c], 1e-6);
+        EXPECT_NEAR(m[c]*sz.area(), cv::sum(src)[c], 1e-12*sz.area()*100);
+    }
+    const int normTypes[] = { NORM_INF, NORM_L1, NORM_L2 };
+    for (int normType : normTypes)
+    {
+        EXPECT_LE(cvtest::norm(src, normType, mask), cv::norm(src, normType, mask)*(1 + 1e-9)) << normType;
+        EXPECT_GE(cvtest::norm(src, normType, mask), cv::norm(src, normType, mask)*(1 - 1e-9)) << normType;
+        EXPECT_LE(cvtest::norm(src, src2, normType), cv::norm(src, src2, normType)*(1 + 1e-9)) << normType;
+        EXPECT_GE(cvtest::norm(src, src2, normType), cv::norm(src, src2, normType)*(1 - 1e-9)) << normType;
+    }
+    EXPECT_EQ((int)cvtest::norm(mask, NORM_L1), cv::countNonZero(mask));
+    if (cn == 1)
+    {
+        double minVal = 0, maxVal = 0, refMinVal = 0, refMaxVal = 0;
+        Point minLoc, maxLoc;
+        std::vector<int> refMinLoc, refMaxLoc;
+        cv::minMaxLoc(src, &minVal, &maxVal, &minLoc, &maxLoc, mask);
+        cvtest::minMaxLoc(src, &refMinVal, &refMaxVal, &refMinLoc, &refMaxLoc, mask);
+        EXPECT_EQ(refMinVal, minVal);
+        EXPECT_EQ(refMaxVal, maxVal);
+        // the first occurrence of the repeated extremums
+        EXPECT_EQ(Point(refMinLoc[1], refMinLoc[0]), minLoc);
+        EXPECT_EQ(Point(refMaxLoc[1], refMaxLoc[0]), maxLoc);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_Reduce_Parallel, testing::Combine(
+    testing::Values(Size(2400, 1800), Size(4400000, 1)),
+    testing::Values(CV_8UC1, CV_8UC3, CV_32FC1)
+));
+
 
 }} // namespace
@@ -2746,6 +2746,38 @@ TEST(Core_CrossProduct, accuracy) { Core_CrossProductTest test; test.safe_run();
 TEST(Core_Determinant, accuracy) { Core_DetTest test; test.safe_run(); }
 TEST(Core_DotProduct, accuracy) { Core_DotProductTest test; test.safe_run(); }
 TEST(Core_GEMM, accuracy) { Core_GEMMTest test; test.safe_run(); }
+
+typedef testing::TestWithParam<std::tuple<int, int>> Core_GEMM_Blocked;
+
+// sizes are not multiples of the blocks used by the packed implementation
+TEST_P(Core_GEMM_Blocked, accuracy)
+{
+    const int type = std::get<0>(GetParam()), flags = std::get<1>(GetParam());
+    const int M = 131, N = 517, K = 301;
+    RNG& rng = theRNG();
+    Mat A = (flags & GEMM_1_T) ? Mat(K, M, type) : Mat(M, K, type);
+    Mat B = (flags & GEMM_2_T) ? Mat(N, K, type) : Mat(K, N, type);
+    Mat C = (flags & GEMM_3_T) ? Mat(N, M, type) : Mat(M, N, type);
+    // non-continuous A
+    Mat A_roi(A.rows + 2, A.cols + 3, type);
+    A = A_roi(Rect(1, 1, A.cols, A.rows));
+    rng.fill(A, RNG::UNIFORM, -1, 1);
+    rng.fill(B, RNG::UNIFORM, -1, 1);
+    rng.fill(C, RNG::UNIFORM, -1, 1);
+
+    Mat dst, ref;
+    cv::gemm(A, B, 0.7, C, -1.3, dst, flags);
+    cvtest::gemm(A, B, 0.7, C, -1.3, ref, flags);
+    EXPECT_LE(cvtest::norm(dst, ref, NORM_INF | NORM_RELATIVE), CV_MAT_DEPTH(type) == CV_32F ? 1e-5 : 1e-12);
+
+    cv::gemm(A, B, 0.7, noArray(), 0, dst, flags);
+    cvtest::gemm(A, B, 0.7, Mat(), 0, ref, flags);
+    EXPECT_LE(cvtest::norm(dst, ref, NORM_INF | NORM_RELATIVE), CV_MAT_DEPTH(type) == CV_32F ? 1e-5 : 1e-12);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_GEMM_Blocked, testing::Combine(
+    testing::Values(CV_32FC1, CV_64FC1, CV_32FC2, CV_64FC2),
+    testing::Values(0, (int)GEMM_1_T, (int)GEMM_2_T, (int)(GEMM_1_T|GEMM_2_T), (int)GEMM_3_T, (int)(GEMM_1_T|GEMM_2_T|GEMM_3_T))));
 TEST(Core_Invert, accuracy) { Core_InvertTest test; test.safe_run(); }
 TEST(Core_Mahalanobis, accuracy) { Core_MahalanobisTest test; test.safe_run(); }
 TEST(Core_MulTransposed, accuracy) { Core_MulTransposedTest test; test.safe_run(); }
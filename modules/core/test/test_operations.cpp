@@ -1570,6 +1570,76 @@ TEST(Core_Arithm, scalar_handling_19599)  // https://github.com/opencv/opencv/is
     EXPECT_EQ(1, c.rows);
 }
 
+// Element-wise chains of floating-point expressions are evaluated in a single pass
+typedef testing::TestWithParam<perf::MatType> Core_MatExpr_Fused;
+
+TEST_P(Core_MatExpr_Fused, accuracy)
+{
+    const int type = GetParam(), cn = CV_MAT_CN(type);
+    const double eps = CV_MAT_DEPTH(type) == CV_32F ? 1e-5 : 1e-12;
+    RNG& rng = theRNG();
+    Mat a0(203, 317, type), b0(203, 317, type);
+    cvtest::randUni(rng, a0, Scalar::all(-1), Scalar::all(1));
+    cvtest::randUni(rng, b0, Scalar::all(-1), Scalar::all(1));
+
+    for (int roi = 0; roi < 2; roi++)
+    {
+        SCOPED_TRACE(roi ? "roi" : "full");
+        Rect r = roi ? Rect(3, 5, 250, 101) : Rect(0, 0, a0.cols, a0.rows);
+        Mat a = a0(r), b = b0(r), t0, t1, ref;
+
+        cv::subtract(a, b, t0);
+        cv::add(a, b, t1);
+        cv::multiply(t0, t1, ref, 0.5);
+        cv::add(ref, Scalar(1, 2, 3, 4), ref);
+        Mat res = (a - b).mul(a + b)*0.5 + Scalar(1, 2, 3, 4);
+        ASSERT_EQ(type, res.type());
+        EXPECT_LE(cvtest::norm(ref, res, NORM_INF), eps*10);
+
+        cv::scaleAdd(a, 2, -b, t0);
+        cv::min(t0, 0.25, t0);
+        cv::max(a, b*(1./3), t1);
+        cv::add(t0, t1, ref);
+        res = min(a*2 - b, 0.25) + max(a, b/3);
+        EXPECT_LE(cvtest::norm(ref, res, NORM_INF), eps*10);
+
+        cv::add(a, b, t0);
+        cv::add(t0, Scalar::all(10), t0);
+        cv::divide(1, t0, ref);
+        res = 1./(a + b + 10);
+        EXPECT_LE(cvtest::norm(ref, res, NORM_INF), eps);
+
+        cv::absdiff(a, b, t0);
+        cv::multiply(t0, a, ref);
+        res = abs(a - b).mul(a);
+        EXPECT_LE(cvtest::norm(ref, res, NORM_INF), eps);
+
+        // in-place evaluation
+        res = a.clone();
+        res = (res - b)/(res + b*0.5 + 3);
+        cv::subtract(a, b, t0);
+        cv::scaleAdd(b, 0.5, a, t1);
+        cv::add(t1, Scalar::all(3), t1);
+        cv::divide(t0, t1, ref);
+        EXPECT_LE(cvtest::norm(ref, res, NORM_INF), eps*10);
+
+        if (cn == 1)
+        {
+            cv::absdiff(a, b, t0);
+            cv::compare(t0, 0.5, ref, CMP_GT);
+            res = abs(a - b) > 0.5;
+            ASSERT_EQ(CV_8UC1, res.type());
+            EXPECT_EQ(0, cvtest::norm(ref, res, NORM_INF));
+
+            cv::compare(t0, a, ref, CMP_LE);
+            res = a >= abs(a - b);
+            EXPECT_EQ(0, cvtest::norm(ref, res, NORM_INF));
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_MatExpr_Fused, testing::Values(CV_32FC1, CV_32FC3, CV_64FC1, CV_64FC4));
+
 // https://github.com/opencv/opencv/issues/24163
 typedef tuple<perf::MatDepth,int,int,int> Arith_Regression24163Param;
 typedef testing::TestWithParam<Arith_Regression24163Param> Core_Arith_Regression24163;
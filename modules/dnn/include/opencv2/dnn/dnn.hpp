@@ -1136,7 +1136,7 @@ CV__DNN_INLINE_NS_BEGIN
      *  @param swapRB flag which indicates that swap first and last channels
      *  in 3-channel image is necessary.
      *  @param crop flag which indicates whether image will be cropped after resize or not
-     *  @param ddepth Depth of output blob. Choose CV_32F or CV_8U.
+     *  @param ddepth Depth of output blob. Choose CV_32F, CV_16F, CV_8U or CV_8S.
      *  @details if @p crop is true, input image is resized so one side after resize is equal to corresponding
      *  dimension in @p size and another one is equal or larger. Then, crop from the center is performed.
      *  If @p crop is false, direct resize without cropping and preserving aspect ratio is performed.
@@ -1169,7 +1169,7 @@ CV__DNN_INLINE_NS_BEGIN
      *  @param swapRB flag which indicates that swap first and last channels
      *  in 3-channel image is necessary.
      *  @param crop flag which indicates whether image will be cropped after resize or not
-     *  @param ddepth Depth of output blob. Choose CV_32F or CV_8U.
+     *  @param ddepth Depth of output blob. Choose CV_32F, CV_16F, CV_8U or CV_8S.
      *  @details if @p crop is true, input image is resized so one side after resize is equal to corresponding
      *  dimension in @p size and another one is equal or larger. Then, crop from the center is performed.
      *  If @p crop is false, direct resize without cropping and preserving aspect ratio is performed.
@@ -1226,7 +1226,7 @@ CV__DNN_INLINE_NS_BEGIN
         CV_PROP_RW Size size;    //!< Spatial size for output image.
         CV_PROP_RW Scalar mean;  //!< Scalar with mean values which are subtracted from channels.
         CV_PROP_RW bool swapRB;  //!< Flag which indicates that swap first and last channels
-        CV_PROP_RW int ddepth;   //!< Depth of output blob. Choose CV_32F or CV_8U.
+        CV_PROP_RW int ddepth;   //!< Depth of output blob. Choose CV_32F, CV_16F, CV_8U or CV_8S.
         CV_PROP_RW DataLayout datalayout; //!< Order of output dimensions. Choose DNN_LAYOUT_NCHW or DNN_LAYOUT_NHWC.
         CV_PROP_RW ImagePaddingMode paddingmode;   //!< Image padding mode. @see ImagePaddingMode.
         CV_PROP_RW Scalar borderValue;   //!< Value used in padding mode for padding.
@@ -1334,6 +1334,8 @@ CV__DNN_INLINE_NS_BEGIN
                              const float eta = 1.f, const int top_k = 0);
 
     /** @brief Performs batched non maximum suppression on given boxes and corresponding scores across different classes.
+     *
+     * Boxes of different classes never suppress each other. With `eta == 1` the classes are processed in parallel.
 
      * @param bboxes a set of bounding boxes to apply NMS.
      * @param scores a set of corresponding confidences.
@@ -6,6 +6,8 @@
 
 #include <opencv2/imgproc.hpp>
 #include <opencv2/core/utils/logger.hpp>
+#include <opencv2/core/hal/hal.hpp>
+#include <opencv2/core/hal/intrin.hpp>
 
 
 namespace cv {
@@ -126,6 +128,394 @@ Mat blobFromImagesWithParams(InputArrayOfArrays images, const Image2BlobParams&
     return blob;
 }
 
+namespace {
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline void v_expand_f32(const v_uint8& v, v_float32& f0, v_float32& f1, v_float32& f2, v_float32& f3)
+{
+    v_uint16 w0, w1;
+    v_expand(v, w0, w1);
+    v_uint32 d0, d1, d2, d3;
+    v_expand(w0, d0, d1);
+    v_expand(w1, d2, d3);
+    f0 = v_cvt_f32(v_reinterpret_as_s32(d0));
+    f1 = v_cvt_f32(v_reinterpret_as_s32(d1));
+    f2 = v_cvt_f32(v_reinterpret_as_s32(d2));
+    f3 = v_cvt_f32(v_reinterpret_as_s32(d3));
+}
+
+static inline void v_store_f32x4(float* ptr, const v_float32& f0, const v_float32& f1,
+                                 const v_float32& f2, const v_float32& f3)
+{
+    const int FL = VTraits<v_float32>::vlanes();
+    v_store(ptr, f0);
+    v_store(ptr + FL, f1);
+    v_store(ptr + 2*FL, f2);
+    v_store(ptr + 3*FL, f3);
+}
+
+// Converts 8-bit pixels to float planes (NCHW) or to the interleaved float row (NHWC).
+// Returns the number of converted pixels.
+static int convertRow8u(const uchar* src, int width, int cn, bool swapRB, bool nchw, float* const* dst)
+{
+    const int VL = VTraits<v_uint8>::vlanes(), FL = VTraits<v_float32>::vlanes();
+    int x = 0;
+    if (cn == 1 || (!nchw && !swapRB))
+    {
+        // Channel order is kept, so the row is converted element-wise
+        const int len = width*cn;
+        int i = 0;
+        for (; i <= len - VL; i += VL)
+        {
+            v_float32 f0, f1, f2, f3;
+            v_expand_f32(vx_load(src + i), f0, f1, f2, f3);
+            v_store_f32x4(dst[0] + i, f0, f1, f2, f3);
+        }
+        return i / cn;
+    }
+    if (cn == 3)
+    {
+        for (; x <= width - VL; x += VL)
+        {
+            v_uint8 a, b, c;
+            v_load_deinterleave(src + x*3, a, b, c);
+            v_float32 a0, a1, a2, a3, b0, b1, b2, b3, c0, c1, c2, c3;
+            v_expand_f32(a, a0, a1, a2, a3);
+            v_expand_f32(b, b0, b1, b2, b3);
+            v_expand_f32(c, c0, c1, c2, c3);
+            if (nchw)
+            {
+                v_store_f32x4(dst[swapRB ? 2 : 0] + x, a0, a1, a2, a3);
+                v_store_f32x4(dst[1] + x, b0, b1, b2, b3);
+                v_store_f32x4(dst[swapRB ? 0 : 2] + x, c0, c1, c2, c3);
+            }
+            else
+            {
+                float* d = dst[0] + x*3;
+                v_store_interleave(d,        c0, b0, a0);
+                v_store_interleave(d + 3*FL, c1, b1, a1);
+                v_store_interleave(d + 6*FL, c2, b2, a2);
+                v_store_interleave(d + 9*FL, c3, b3, a3);
+            }
+        }
+    }
+    else if (cn == 4)
+    {
+        for (; x <= width - VL; x += VL)
+        {
+            v_uint8 a, b, c, e;
+            v_load_deinterleave(src + x*4, a, b, c, e);
+            v_float32 a0, a1, a2, a3, b0, b1, b2, b3, c0, c1, c2, c3, e0, e1, e2, e3;
+            v_expand_f32(a, a0, a1, a2, a3);
+            v_expand_f32(b, b0, b1, b2, b3);
+            v_expand_f32(c, c0, c1, c2, c3);
+            v_expand_f32(e, e0, e1, e2, e3);
+            if (nchw)
+            {
+                v_store_f32x4(dst[swapRB ? 2 : 0] + x, a0, a1, a2, a3);
+                v_store_f32x4(dst[1] + x, b0, b1, b2, b3);
+                v_store_f32x4(dst[swapRB ? 0 : 2] + x, c0, c1, c2, c3);
+                v_store_f32x4(dst[3] + x, e0, e1, e2, e3);
+            }
+            else
+            {
+                float* d = dst[0] + x*4;
+                v_store_interleave(d,         c0, b0, a0, e0);
+                v_store_interleave(d + 4*FL,  c1, b1, a1, e1);
+                v_store_interleave(d + 8*FL,  c2, b2, a2, e2);
+                v_store_interleave(d + 12*FL, c3, b3, a3, e3);
+            }
+        }
+    }
+    return x;
+}
+#endif
+
+// Converts the image row to float with the blob layout and channel order
+template<typename T>
+static void convertRow(const T* src, int width, int cn, bool swapRB, bool nchw, float* const* dst)
+{
+    int x = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    if (std::is_same<T, uchar>::value)
+        x = convertRow8u(reinterpret_cast<const uchar*>(src), width, cn, swapRB, nchw, dst);
+#endif
+    for (; x < width; x++)
+    {
+        for (int c = 0; c < cn; c++)
+        {
+            const int o = swapRB && c != 1 && c < 3 ? 2 - c : c;
+            if (nchw)
+                dst[o][x] = (float)src[x*cn + c];
+            else
+                dst[0][x*cn + o] = (float)src[x*cn + c];
+        }
+    }
+}
+
+// dst[i] = (dst[i] - mean[i % period]) * scale[i % period]
+static void normalizeRow(float* dst, int len, int period, const float* mean, const float* scale)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int FL = VTraits<v_float32>::vlanes();
+    if (period == 1)
+    {
+        const v_float32 vmean = vx_setall_f32(mean[0]), vscale = vx_setall_f32(scale[0]);
+        for (; i <= len - FL; i += FL)
+            v_store(dst + i, v_mul(v_sub(vx_load(dst + i), vmean), vscale));
+    }
+    else
+    {
+        // period*FL elements hold a whole number of both pixels and vectors
+        AutoBuffer<float> pattern(2*period*FL);
+        float* pmean = pattern.data();
+        float* pscale = pmean + period*FL;
+        for (int k = 0; k < period*FL; k++)
+        {
+            pmean[k] = mean[k % period];
+            pscale[k] = scale[k % period];
+        }
+        for (; i <= len - period*FL; i += period*FL)
+        {
+            for (int k = 0; k < period*FL; k += FL)
+                v_store(dst + i + k, v_mul(v_sub(vx_load(dst + i + k), vx_load(pmean + k)), vx_load(pscale + k)));
+        }
+    }
+#endif
+    for (; i < len; i++)
+        dst[i] = (dst[i] - mean[i % period]) * scale[i % period];
+}
+
+static void storeRow(const float* src, uchar* dst, int len, int ddepth)
+{
+    if (ddepth == CV_16F)
+    {
+        hal::cvt32f16f(src, reinterpret_cast<hfloat*>(dst), len);
+        return;
+    }
+    CV_DbgAssert(ddepth == CV_8U || ddepth == CV_8S);
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int FL = VTraits<v_float32>::vlanes();
+    for (; i <= len - 4*FL; i += 4*FL)
+    {
+        v_int16 s0 = v_pack(v_round(vx_load(src + i)), v_round(vx_load(src + i + FL)));
+        v_int16 s1 = v_pack(v_round(vx_load(src + i + 2*FL)), v_round(vx_load(src + i + 3*FL)));
+        if (ddepth == CV_8U)
+            v_store(dst + i, v_pack_u(s0, s1));
+        else
+            v_store(reinterpret_cast<schar*>(dst) + i, v_pack(s0, s1));
+    }
+#endif
+    if (ddepth == CV_8U)
+    {
+        for (; i < len; i++)
+            dst[i] = saturate_cast<uchar>(src[i]);
+    }
+    else
+    {
+        for (; i < len; i++)
+            reinterpret_cast<schar*>(dst)[i] = saturate_cast<schar>(src[i]);
+    }
+}
+
+// Fills the blob rows from the resized images in a single pass per row:
+// padding, channel swap, (x - mean) * scale, data layout and output depth.
+class BlobFromImagesInvoker : public ParallelLoopBody
+{
+public:
+    BlobFromImagesInvoker(const std::vector<Mat>& images, const std::vector<Point>& offsets, Mat& blob,
+                          const Scalar& mean, const Scalar& scale, const Scalar& borderValue,
+                          bool swapRB, bool nchw)
+        : images_(images), offsets_(offsets), blob_(blob), swapRB_(swapRB), nchw_(nchw)
+    {
+        cn_ = images[0].channels();
+        height_ = nchw ? blob.size[2] : blob.size[1];
+        width_ = nchw ? blob.size[3] : blob.size[2];
+        normalize_ = false;
+        for (int c = 0; c < 4; c++)
+        {
+            mean_[c] = (float)mean[c];
+            scale_[c] = (float)scale[c];
+            normalize_ |= c < cn_ && (mean_[c] != 0.f || scale_[c] != 1.f);
+        }
+        // Padding is applied to the source image, so the value is saturated to its depth
+        borderPixel_.create(1, 1, images[0].type());
+        borderPixel_.setTo(borderValue);
+    }
+
+    void operator()(const Range& r) const CV_OVERRIDE
+    {
+        const int ddepth = blob_.depth();
+        const size_t esz = borderPixel_.elemSize();
+        AutoBuffer<float> fbuf(ddepth == CV_32F ? 1 : width_*cn_);
+        AutoBuffer<uchar> sbuf(width_*esz);
+
+        for (int row = r.start; row < r.end; row++)
+        {
+            const int n = row / height_, y = row % height_;
+            const Mat& img = images_[n];
+            const Point& ofs = offsets_[n];
+
+            const uchar* src = nullptr;
+            if (img.cols == width_ && img.rows == height_)
+            {
+                src = img.ptr(y);
+            }
+            else
+            {
+                // Letterbox: compose the padded source row
+                uchar* buf = sbuf.data();
+                for (int x = 0; x < width_; x++)
+                    memcpy(buf + x*esz, borderPixel_.data, esz);
+                if (y >= ofs.y && y < ofs.y + img.rows)
+                    memcpy(buf + ofs.x*esz, img.ptr(y - ofs.y), img.cols*esz);
+                src = buf;
+            }
+
+            float* dst[4] = {};
+            for (int o = 0; o < (nchw_ ? cn_ : 1); o++)
+            {
+                dst[o] = ddepth == CV_32F ? (nchw_ ? blob_.ptr<float>(n, o, y) : blob_.ptr<float>(n, y))
+                                          : fbuf.data() + o*width_;
+            }
+
+            if (img.depth() == CV_8U)
+                convertRow(src, width_, cn_, swapRB_, nchw_, dst);
+            else
+                convertRow(reinterpret_cast<const float*>(src), width_, cn_, swapRB_, nchw_, dst);
+
+            if (normalize_)
+            {
+                if (nchw_)
+                {
+                    for (int o = 0; o < cn_; o++)
+                        normalizeRow(dst[o], width_, 1, mean_ + o, scale_ + o);
+                }
+                else
+                {
+                    normalizeRow(dst[0], width_*cn_, cn_, mean_, scale_);
+                }
+            }
+
+            if (ddepth != CV_32F)
+            {
+                if (nchw_)
+                {
+                    for (int o = 0; o < cn_; o++)
+                        storeRow(dst[o], blob_.ptr(n, o, y), width_, ddepth);
+                }
+                else
+                {
+                    storeRow(dst[0], blob_.ptr(n, y), width_*cn_, ddepth);
+                }
+            }
+        }
+    }
+
+private:
+    const std::vector<Mat>& images_;
+    const std::vector<Point>& offsets_;
+    Mat& blob_;
+    Mat borderPixel_;
+    float mean_[4], scale_[4];  // In the blob channel order
+    int cn_, width_, height_;
+    bool swapRB_, nchw_, normalize_;
+};
+
+// Resamples the images (resize stays in cv::resize to keep the results bit-exact)
+// and does everything else in one parallel pass over the blob rows.
+// Returns false if the input is not supported, so the generic path should be used.
+static bool blobFromImagesFused(const std::vector<Mat>& images, Mat& blob, const Image2BlobParams& param)
+{
+    const int type = images[0].type();
+    const int nch = CV_MAT_CN(type), sdepth = CV_MAT_DEPTH(type);
+    if (nch != 1 && nch != 3 && nch != 4)
+        return false;
+    if (sdepth != CV_8U && sdepth != CV_32F)
+        return false;
+    if (param.ddepth == CV_8U && sdepth != CV_8U)
+        return false;
+    if (param.datalayout != DNN_LAYOUT_NCHW && param.datalayout != DNN_LAYOUT_NHWC)
+        return false;
+    for (const Mat& img : images)
+    {
+        if (img.empty() || img.dims != 2 || img.type() != type)
+            return false;
+    }
+
+    Size size = param.size;
+    if (size == Size())
+        size = images[0].size();
+
+    std::vector<Mat> resized(images.size());
+    std::vector<Point> offsets(images.size());
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        Size imgSize = images[i].size();
+        if (size == imgSize)
+        {
+            resized[i] = images[i];
+        }
+        else if (param.paddingmode == DNN_PMODE_CROP_CENTER)
+        {
+            float resizeFactor = std::max(size.width / (float)imgSize.width,
+                                          size.height / (float)imgSize.height);
+            resize(images[i], resized[i], Size(), resizeFactor, resizeFactor, INTER_LINEAR);
+            Rect crop(Point(0.5 * (resized[i].cols - size.width),
+                            0.5 * (resized[i].rows - size.height)),
+                      size);
+            resized[i] = resized[i](crop);
+        }
+        else if (param.paddingmode == DNN_PMODE_LETTERBOX)
+        {
+            float resizeFactor = std::min(size.width / (float)imgSize.width,
+                                          size.height / (float)imgSize.height);
+            int rh = int(imgSize.height * resizeFactor);
+            int rw = int(imgSize.width * resizeFactor);
+            resize(images[i], resized[i], Size(rw, rh), INTER_LINEAR);
+            offsets[i] = Point((size.width - rw)/2, (size.height - rh)/2);
+        }
+        else
+        {
+            resize(images[i], resized[i], size, 0, 0, INTER_LINEAR);
+        }
+    }
+
+    const bool nchw = param.datalayout == DNN_LAYOUT_NCHW;
+    const int nimages = (int)images.size();
+    if (nchw)
+    {
+        int sz[] = { nimages, nch, size.height, size.width };
+        blob.create(4, sz, param.ddepth);
+    }
+    else
+    {
+        int sz[] = { nimages, size.height, size.width, nch };
+        blob.create(4, sz, param.ddepth);
+    }
+
+    bool swapRB = param.swapRB;
+    if (swapRB && nch < 3)
+    {
+        CV_LOG_WARNING(NULL, "Red/blue color swapping requires at least three image channels.");
+        swapRB = false;
+    }
+
+    BlobFromImagesInvoker body(resized, offsets, blob, param.mean, param.scalefactor,
+                               param.borderValue, swapRB, nchw);
+    parallel_for_(Range(0, nimages*size.height), body);
+    return true;
+}
+
+static bool blobFromImagesFused(const std::vector<UMat>&, UMat&, const Image2BlobParams&)
+{
+    return false;
+}
+
+}  // namespace
+
 template<class Tmat>
 void blobFromImagesWithParamsImpl(InputArrayOfArrays images_, Tmat& blob_, const Image2BlobParams& param)
 {
@@ -135,8 +525,9 @@ void blobFromImagesWithParamsImpl(InputArrayOfArrays images_, Tmat& blob_, const
         CV_Error(Error::StsBadArg, error_message);
     }
 
-    CV_CheckType(param.ddepth, param.ddepth == CV_32F || param.ddepth == CV_8U,
-                 "Blob depth should be CV_32F or CV_8U");
+    CV_CheckType(param.ddepth, param.ddepth == CV_32F || param.ddepth == CV_16F ||
+                               param.ddepth == CV_8U || param.ddepth == CV_8S,
+                 "Blob depth should be CV_32F, CV_16F, CV_8U or CV_8S");
     Size size = param.size;
 
     std::vector<Tmat> images;
@@ -150,6 +541,9 @@ void blobFromImagesWithParamsImpl(InputArrayOfArrays images_, Tmat& blob_, const
         CV_Assert(param.mean == Scalar() && "Mean subtraction is not supported for CV_8U blob depth");
     }
 
+    if (blobFromImagesFused(images, blob_, param))
+        return;
+
     int nch = images[0].channels();
     Scalar scalefactor = param.scalefactor;
     Scalar mean = param.mean;
@@ -204,11 +598,14 @@ void blobFromImagesWithParamsImpl(InputArrayOfArrays images_, Tmat& blob_, const
             }
         }
 
-        if (images[i].depth() == CV_8U && param.ddepth == CV_32F)
+        if (images[i].depth() == CV_8U && param.ddepth != CV_8U)
             images[i].convertTo(images[i], CV_32F);
 
         subtract(images[i], mean, images[i]);
         multiply(images[i], scalefactor, images[i]);
+
+        if (param.ddepth == CV_16F || param.ddepth == CV_8S)
+            images[i].convertTo(images[i], param.ddepth);
     }
 
     size_t nimages = images.size();
@@ -19,13 +19,196 @@ static inline float rectOverlap(const T& a, const T& b)
     return 1.f - static_cast<float>(jaccardDistance(a, b));
 }
 
+// Uniform grid over the boxes, used to find the boxes which may overlap the given one.
+//
+// The IoU of two boxes with positive areas and no common pixels is exactly 0,
+// so such pairs never change the result of NMS and can be skipped.
+// Degenerate boxes (empty, or with the area within the type epsilon) may have
+// the IoU of 1 with boxes far away (see jaccardDistance), so they are compared
+// with everything. Boxes covering too many cells are kept out of the grid too.
+template<typename T>
+class BoxGrid
+{
+public:
+    BoxGrid(const std::vector<Rect_<T> >& bboxes, const std::vector<std::pair<float, int> >& candidates)
+        : boxes(bboxes), visited(bboxes.size(), -1), query(0), gx(0), gy(0), minx(0), miny(0), cw(0), ch(0), eps(0)
+    {
+        // Small sets are processed faster by comparing all the pairs
+        if (candidates.size() < 64)
+            return;
+
+        double x0 = DBL_MAX, y0 = DBL_MAX, x1 = -DBL_MAX, y1 = -DBL_MAX, sw = 0, sh = 0, maxAbs = 0;
+        int nregular = 0;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const Rect_<T>& b = boxes[candidates[i].second];
+            if (!isRegular(b))
+                continue;
+            x0 = std::min(x0, (double)b.x);
+            y0 = std::min(y0, (double)b.y);
+            x1 = std::max(x1, (double)b.x + b.width);
+            y1 = std::max(y1, (double)b.y + b.height);
+            sw += b.width;
+            sh += b.height;
+            nregular++;
+        }
+        if (nregular == 0)
+            return;
+        maxAbs = std::max(std::max(std::abs(x0), std::abs(x1)), std::max(std::abs(y0), std::abs(y1)));
+
+        // Cells of the average box size, but not too many of them
+        const int maxCells = 256;
+        cw = std::max(sw / nregular, (x1 - x0) / maxCells);
+        ch = std::max(sh / nregular, (y1 - y0) / maxCells);
+        if (!(cw > 0 && ch > 0))
+            return;
+        gx = std::min(cvFloor((x1 - x0) / cw) + 1, maxCells);
+        gy = std::min(cvFloor((y1 - y0) / ch) + 1, maxCells);
+        minx = x0;
+        miny = y0;
+        // Rect intersection rounds differently from x + width, so the grid
+        // lookups are done with a margin for the floating-point boxes
+        eps = std::numeric_limits<T>::is_integer ? 0. : maxAbs * 1e-12;
+        cells.resize((size_t)gx * gy);
+    }
+
+    void add(int idx)
+    {
+        int cx0, cx1, cy0, cy1;
+        if (!isRegular(boxes[idx]) || !cellRange(boxes[idx], cx0, cx1, cy0, cy1) ||
+            (cx1 - cx0 + 1) * (cy1 - cy0 + 1) > 16)
+        {
+            others.push_back(idx);
+            return;
+        }
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+                cells[(size_t)cy * gx + cx].push_back(idx);
+        bucketed.push_back(idx);
+    }
+
+    // Calls func(i) for the added boxes which may overlap the box idx, stops as soon as func returns false.
+    // Returns false if stopped.
+    template<typename Func>
+    bool forEachNeighbor(int idx, Func func)
+    {
+        for (size_t i = 0; i < others.size(); i++)
+            if (!func(others[i]))
+                return false;
+
+        const Rect_<T>& b = boxes[idx];
+        int cx0, cx1, cy0, cy1;
+        if (!isRegular(b) || !cellRange(b, cx0, cx1, cy0, cy1))
+        {
+            for (size_t i = 0; i < bucketed.size(); i++)
+                if (!func(bucketed[i]))
+                    return false;
+            return true;
+        }
+
+        query++;
+        for (int cy = cy0; cy <= cy1; cy++)
+        {
+            for (int cx = cx0; cx <= cx1; cx++)
+            {
+                const std::vector<int>& cell = cells[(size_t)cy * gx + cx];
+                for (size_t i = 0; i < cell.size(); i++)
+                {
+                    const int j = cell[i];
+                    if (visited[j] == query)
+                        continue;
+                    visited[j] = query;
+                    if (mayIntersect(b, boxes[j]) && !func(j))
+                        return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    static bool isRegular(const Rect_<T>& b)
+    {
+        return b.width > 0 && b.height > 0 && b.area() > std::numeric_limits<T>::epsilon();
+    }
+
+    bool mayIntersect(const Rect_<T>& a, const Rect_<T>& b) const
+    {
+        return (double)a.x + a.width > (double)b.x - eps && (double)b.x + b.width > (double)a.x - eps &&
+               (double)a.y + a.height > (double)b.y - eps && (double)b.y + b.height > (double)a.y - eps;
+    }
+
+    bool cellRange(const Rect_<T>& b, int& cx0, int& cx1, int& cy0, int& cy1) const
+    {
+        if (gx == 0)
+            return false;
+        const double fx0 = ((double)b.x - eps - minx) / cw, fx1 = ((double)b.x + b.width + eps - minx) / cw;
+        const double fy0 = ((double)b.y - eps - miny) / ch, fy1 = ((double)b.y + b.height + eps - miny) / ch;
+        if (!(fx0 <= fx1 && fy0 <= fy1))  // NaNs
+            return false;
+        cx0 = clampCell(fx0, gx);
+        cx1 = clampCell(fx1, gx);
+        cy0 = clampCell(fy0, gy);
+        cy1 = clampCell(fy1, gy);
+        return true;
+    }
+
+    static int clampCell(double f, int n)
+    {
+        return f <= 0 ? 0 : f >= n - 1 ? n - 1 : cvFloor(f);
+    }
+
+    const std::vector<Rect_<T> >& boxes;
+    std::vector<std::vector<int> > cells;
+    std::vector<int> bucketed, others;
+    std::vector<int> visited;
+    int query;
+    int gx, gy;
+    double minx, miny, cw, ch, eps;
+};
+
+// Greedy NMS over the sorted candidates, gives the same result as NMSFast_ with rectOverlap
+template<typename T>
+static void NMSGrid_(const std::vector<Rect_<T> >& bboxes,
+                     const std::vector<std::pair<float, int> >& score_index_vec,
+                     const float nms_threshold, const float eta, std::vector<int>& indices)
+{
+    BoxGrid<T> grid(bboxes, score_index_vec);
+    float adaptive_threshold = nms_threshold;
+    indices.clear();
+    for (size_t i = 0; i < score_index_vec.size(); ++i)
+    {
+        const int idx = score_index_vec[i].second;
+        bool keep = grid.forEachNeighbor(idx, [&](int kept_idx) {
+            return rectOverlap(bboxes[idx], bboxes[kept_idx]) <= adaptive_threshold;
+        });
+        if (keep)
+        {
+            indices.push_back(idx);
+            grid.add(idx);
+            if (eta < 1 && adaptive_threshold > 0.5)
+                adaptive_threshold *= eta;
+        }
+    }
+}
+
+template<typename T>
+static void NMSBoxesImpl(const std::vector<Rect_<T> >& bboxes, const std::vector<float>& scores,
+                         const float score_threshold, const float nms_threshold,
+                         std::vector<int>& indices, const float eta, const int top_k)
+{
+    std::vector<std::pair<float, int> > score_index_vec;
+    GetMaxScoreIndex(scores, score_threshold, top_k, score_index_vec);
+    NMSGrid_(bboxes, score_index_vec, nms_threshold, eta, indices);
+}
+
 void NMSBoxes(const std::vector<Rect>& bboxes, const std::vector<float>& scores,
                           const float score_threshold, const float nms_threshold,
                           std::vector<int>& indices, const float eta, const int top_k)
 {
     CV_Assert_N(bboxes.size() == scores.size(), score_threshold >= 0,
         nms_threshold >= 0, eta > 0);
-    NMSFast_(bboxes, scores, score_threshold, nms_threshold, eta, top_k, indices, rectOverlap);
+    NMSBoxesImpl(bboxes, scores, score_threshold, nms_threshold, indices, eta, top_k);
 }
 
 void NMSBoxes(const std::vector<Rect2d>& bboxes, const std::vector<float>& scores,
@@ -34,7 +217,7 @@ void NMSBoxes(const std::vector<Rect2d>& bboxes, const std::vector<float>& score
 {
     CV_Assert_N(bboxes.size() == scores.size(), score_threshold >= 0,
         nms_threshold >= 0, eta > 0);
-    NMSFast_(bboxes, scores, score_threshold, nms_threshold, eta, top_k, indices, rectOverlap);
+    NMSBoxesImpl(bboxes, scores, score_threshold, nms_threshold, indices, eta, top_k);
 }
 
 static inline float rotatedRectIOU(const RotatedRect& a, const RotatedRect& b)
@@ -58,39 +241,79 @@ void NMSBoxes(const std::vector<RotatedRect>& bboxes, const std::vector<float>&
     NMSFast_(bboxes, scores, score_threshold, nms_threshold, eta, top_k, indices, rotatedRectIOU);
 }
 
-template<class Rect_t>
-static inline void NMSBoxesBatchedImpl(const std::vector<Rect_t>& bboxes,
+template<typename T>
+static inline void NMSBoxesBatchedImpl(const std::vector<Rect_<T> >& bboxes,
                                        const std::vector<float>& scores, const std::vector<int>& class_ids,
                                        const float score_threshold, const float nms_threshold,
                                        std::vector<int>& indices, const float eta, const int top_k)
 {
-    double x1, y1, x2, y2, max_coord = 0;
-    for (int i = 0; i < bboxes.size(); i++)
+    std::vector<std::pair<float, int> > score_index_vec;
+    GetMaxScoreIndex(scores, score_threshold, top_k, score_index_vec);
+
+    if (eta < 1)
     {
-        x1 = bboxes[i].x;
-        y1 = bboxes[i].y;
-        x2 = x1 + bboxes[i].width;
-        y2 = y1 + bboxes[i].height;
-
-        max_coord = std::max(x1, max_coord);
-        max_coord = std::max(y1, max_coord);
-        max_coord = std::max(x2, max_coord);
-        max_coord = std::max(y2, max_coord);
+        // The adaptive threshold depends on the boxes kept in all the classes,
+        // so the classes are separated by offsets and processed together
+        double x1, y1, x2, y2, max_coord = 0;
+        for (size_t i = 0; i < bboxes.size(); i++)
+        {
+            x1 = bboxes[i].x;
+            y1 = bboxes[i].y;
+            x2 = x1 + bboxes[i].width;
+            y2 = y1 + bboxes[i].height;
+
+            max_coord = std::max(x1, max_coord);
+            max_coord = std::max(y1, max_coord);
+            max_coord = std::max(x2, max_coord);
+            max_coord = std::max(y2, max_coord);
+        }
+
+        // calculate offset and add offset to each bbox
+        std::vector<Rect_<T> > bboxes_offset;
+        bboxes_offset.reserve(bboxes.size());
+        double offset;
+        for (size_t i = 0; i < bboxes.size(); i++)
+        {
+            offset = class_ids[i] * (max_coord + 1);
+            bboxes_offset.push_back(
+                Rect_<T>(bboxes[i].x + offset, bboxes[i].y + offset,
+                         bboxes[i].width, bboxes[i].height)
+            );
+        }
+
+        NMSGrid_(bboxes_offset, score_index_vec, nms_threshold, eta, indices);
+        return;
     }
 
-    // calculate offset and add offset to each bbox
-    std::vector<Rect_t> bboxes_offset;
-    double offset;
-    for (int i = 0; i < bboxes.size(); i++)
+    // Otherwise the classes are independent: split the sorted candidates
+    // by class, run NMS for the classes in parallel and merge the results
+    // back in the order of scores
+    std::vector<int> rank(bboxes.size());
+    std::map<int, size_t> class_to_group;
+    std::vector<std::vector<std::pair<float, int> > > groups;
+    for (size_t i = 0; i < score_index_vec.size(); i++)
     {
-        offset = class_ids[i] * (max_coord + 1);
-        bboxes_offset.push_back(
-            Rect_t(bboxes[i].x + offset, bboxes[i].y + offset,
-                   bboxes[i].width, bboxes[i].height)
-        );
+        const int idx = score_index_vec[i].second;
+        rank[idx] = (int)i;
+        auto it = class_to_group.find(class_ids[idx]);
+        if (it == class_to_group.end())
+        {
+            it = class_to_group.insert(std::make_pair(class_ids[idx], groups.size())).first;
+            groups.push_back(std::vector<std::pair<float, int> >());
+        }
+        groups[it->second].push_back(score_index_vec[i]);
     }
 
-    NMSFast_(bboxes_offset, scores, score_threshold, nms_threshold, eta, top_k, indices, rectOverlap);
+    std::vector<std::vector<int> > kept(groups.size());
+    parallel_for_(Range(0, (int)groups.size()), [&](const Range& r) {
+        for (int g = r.start; g < r.end; g++)
+            NMSGrid_(bboxes, groups[g], nms_threshold, eta, kept[g]);
+    });
+
+    indices.clear();
+    for (size_t g = 0; g < kept.size(); g++)
+        indices.insert(indices.end(), kept[g].begin(), kept[g].end());
+    std::sort(indices.begin(), indices.end(), [&](int a, int b) { return rank[a] < rank[b]; });
 }
 
 void NMSBoxesBatched(const std::vector<Rect>& bboxes,
@@ -129,64 +352,85 @@ void softNMSBoxes(const std::vector<Rect>& bboxes,
     indices.clear();
     updated_scores.clear();
 
-    std::vector<std::pair<float, size_t> > score_index_vec(scores.size());
-    for (size_t i = 0; i < scores.size(); i++)
-    {
-        score_index_vec[i].first = scores[i];
-        score_index_vec[i].second = i;
-    }
+    if (method != SoftNMSMethod::SOFTNMS_LINEAR && method != SoftNMSMethod::SOFTNMS_GAUSSIAN)
+        CV_Error(Error::StsBadArg, "Not supported SoftNMS method.");
 
-    const auto score_cmp = [](const std::pair<float, size_t>& a, const std::pair<float, size_t>& b)
+    const auto score_cmp = [](const std::pair<float, int>& a, const std::pair<float, int>& b)
     {
         return a.first == b.first ? a.second > b.second : a.first < b.first;
     };
 
-    top_k = top_k == 0 ? scores.size() : std::min(top_k, scores.size());
-    ptrdiff_t start = 0;
-    while (indices.size() < top_k)
+    // Scores only decrease, so the best box is found with a max-heap where
+    // the entries of the boxes rescored after the push are skipped as stale
+    std::vector<float> cur_scores(scores);
+    std::vector<uchar> chosen(scores.size(), 0);
+    std::vector<std::pair<float, int> > heap, candidates;
+    for (size_t i = 0; i < scores.size(); i++)
     {
-        auto it = std::max_element(score_index_vec.begin() + start, score_index_vec.end(), score_cmp);
+        if (scores[i] >= score_threshold)
+            heap.push_back(std::make_pair(scores[i], (int)i));
+    }
+    candidates = heap;
+    std::make_heap(heap.begin(), heap.end(), score_cmp);
+
+    // With the Gaussian weighting and zero sigma even non-overlapping boxes are
+    // rescored (to NaN), so the grid is used only when it's safe to skip them
+    const bool useGrid = method == SoftNMSMethod::SOFTNMS_LINEAR || sigma > 0;
+    BoxGrid<int> grid(bboxes, useGrid ? candidates : std::vector<std::pair<float, int> >());
+    for (size_t i = 0; i < candidates.size(); i++)
+        grid.add(candidates[i].second);
 
-        float bscore = it->first;
-        size_t bidx = it->second;
+    top_k = top_k == 0 ? scores.size() : std::min(top_k, scores.size());
+    while (indices.size() < top_k && !heap.empty())
+    {
+        std::pop_heap(heap.begin(), heap.end(), score_cmp);
+        const float bscore = heap.back().first;
+        const int bidx = heap.back().second;
+        heap.pop_back();
+        if (chosen[bidx] || bscore != cur_scores[bidx])
+        {
+            continue;
+        }
 
         if (bscore < score_threshold)
         {
             break;
         }
 
-        indices.push_back(static_cast<int>(bidx));
+        indices.push_back(bidx);
         updated_scores.push_back(bscore);
-        std::swap(score_index_vec[start], *it); // first start elements are chosen
-
-        for (size_t i = start + 1; i < scores.size(); ++i)
-        {
-            float& bscore_i = score_index_vec[i].first;
-            const size_t bidx_i = score_index_vec[i].second;
+        chosen[bidx] = 1;
 
-            if (bscore_i < score_threshold)
+        grid.forEachNeighbor(bidx, [&](int i) {
+            float& bscore_i = cur_scores[i];
+            if (chosen[i] || bscore_i < score_threshold)
             {
-                continue;
+                return true;
             }
 
-            float overlap = rectOverlap(bboxes[bidx], bboxes[bidx_i]);
+            const float prev = bscore_i;
+            float overlap = rectOverlap(bboxes[bidx], bboxes[i]);
 
-            switch (method)
+            if (method == SoftNMSMethod::SOFTNMS_LINEAR)
             {
-                case SoftNMSMethod::SOFTNMS_LINEAR:
-                    if (overlap > nms_threshold)
-                    {
-                        bscore_i *= 1.f - overlap;
-                    }
-                    break;
-                case SoftNMSMethod::SOFTNMS_GAUSSIAN:
-                    bscore_i *= exp(-(overlap * overlap) / sigma);
-                    break;
-                default:
-                    CV_Error(Error::StsBadArg, "Not supported SoftNMS method.");
+                if (overlap > nms_threshold)
+                {
+                    bscore_i *= 1.f - overlap;
+                }
             }
-        }
-        ++start;
+            else
+            {
+                bscore_i *= exp(-(overlap * overlap) / sigma);
+            }
+
+            // NB: NaNs would break the heap order, such boxes are never picked anyway
+            if (bscore_i != prev && !cvIsNaN(bscore_i))
+            {
+                heap.push_back(std::make_pair(bscore_i, i));
+                std::push_heap(heap.begin(), heap.end(), score_cmp);
+            }
+            return true;
+        });
     }
 }
 
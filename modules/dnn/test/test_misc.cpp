@@ -242,6 +242,67 @@ TEST(blobFromImagesWithParams_4ch, multi_image)
     EXPECT_EQ(0, cvtest::norm(2 * blob0, blob1, NORM_INF));
 }
 
+TEST(blobFromImagesWithParams, fp16_int8_output)
+{
+    std::vector<Mat> imgs(3);
+    for (size_t i = 0; i < imgs.size(); i++)
+    {
+        imgs[i].create(37 + 5 * (int)i, 53, CV_8UC3);
+        randu(imgs[i], 0, 255);
+    }
+
+    Image2BlobParams param;
+    param.size = Size(40, 32);
+    param.mean = Scalar(100, 110, 120);
+    param.scalefactor = Scalar(0.5, 0.75, 1.0);
+    param.swapRB = true;
+    param.paddingmode = DNN_PMODE_LETTERBOX;
+
+    for (int layout = DNN_LAYOUT_NCHW; layout <= DNN_LAYOUT_NHWC; layout++)
+    {
+        param.datalayout = (DataLayout)layout;
+        param.ddepth = CV_32F;
+        Mat blob32f = blobFromImagesWithParams(imgs, param);
+
+        param.ddepth = CV_16F;
+        Mat blob16f = blobFromImagesWithParams(imgs, param);
+        ASSERT_EQ(CV_16F, blob16f.depth());
+        Mat ref16f;
+        blob32f.convertTo(ref16f, CV_16F);
+        EXPECT_EQ(0, cvtest::norm(ref16f, blob16f, NORM_INF)) << "layout=" << layout;
+
+        param.ddepth = CV_8S;
+        Mat blob8s = blobFromImagesWithParams(imgs, param);
+        ASSERT_EQ(CV_8S, blob8s.depth());
+        Mat ref8s;
+        blob32f.convertTo(ref8s, CV_8S);
+        EXPECT_EQ(0, cvtest::norm(ref8s, blob8s, NORM_INF)) << "layout=" << layout;
+    }
+}
+
+TEST(blobFromImagesWithParams, NHWC_matches_NCHW)
+{
+    Mat img(30, 20, CV_8UC3);
+    randu(img, 0, 255);
+
+    Image2BlobParams param;
+    param.size = Size(24, 24);
+    param.mean = Scalar(1, 2, 3);
+    param.scalefactor = Scalar::all(1.0 / 255);
+    param.swapRB = true;
+    param.paddingmode = DNN_PMODE_CROP_CENTER;
+
+    Mat nchw = blobFromImageWithParams(img, param);
+    param.datalayout = DNN_LAYOUT_NHWC;
+    Mat nhwc = blobFromImageWithParams(img, param);
+
+    std::vector<Mat> planes;
+    imagesFromBlob(nchw, planes);
+    ASSERT_EQ(1u, planes.size());
+    Mat interleaved(24, 24, CV_32FC3, nhwc.ptr<float>());
+    EXPECT_EQ(0, cvtest::norm(planes[0], interleaved, NORM_INF));
+}
+
 TEST(readNet, Regression)
 {
     Net net = readNet(findDataFile("dnn/squeezenet_v1.1.prototxt"),
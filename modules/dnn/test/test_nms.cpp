@@ -67,6 +67,91 @@ TEST(BatchedNMS, Accuracy)
         ASSERT_EQ(indices[i], ref_indices[i]);
 }
 
+template<typename Rect_t>
+static void greedyNMS(const std::vector<Rect_t>& bboxes, const std::vector<float>& scores,
+                      float score_thresh, float nms_thresh, std::vector<int>& indices)
+{
+    std::vector<int> order;
+    for (size_t i = 0; i < scores.size(); i++)
+        if (scores[i] > score_thresh)
+            order.push_back((int)i);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return scores[a] > scores[b]; });
+
+    indices.clear();
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        bool keep = true;
+        for (size_t k = 0; k < indices.size() && keep; k++)
+            keep = 1.f - (float)jaccardDistance(bboxes[order[i]], bboxes[indices[k]]) <= nms_thresh;
+        if (keep)
+            indices.push_back(order[i]);
+    }
+}
+
+TEST(NMS, LargeSet)
+{
+    RNG& rng = theRNG();
+    const int n = 5000;
+    std::vector<Rect> bboxes;
+    std::vector<Rect2d> bboxes2d;
+    std::vector<float> scores;
+    for (int i = 0; i < n; i++)
+    {
+        // some empty and huge boxes are mixed in
+        int w = rng.uniform(0, 10) == 0 ? 0 : rng.uniform(1, 100);
+        int h = rng.uniform(0, 100) == 0 ? 2000 : rng.uniform(1, 100);
+        bboxes.push_back(Rect(rng.uniform(0, 2000), rng.uniform(0, 2000), w, h));
+        bboxes2d.push_back(Rect2d(rng.uniform(0., 2000.), rng.uniform(0., 2000.), rng.uniform(0.5, 100.), rng.uniform(0.5, 100.)));
+        scores.push_back(rng.uniform(0, 100) / 100.f);  // with ties
+    }
+
+    const float score_thresh = .1f, nms_thresh = .3f;
+    std::vector<int> indices, ref_indices;
+    cv::dnn::NMSBoxes(bboxes, scores, score_thresh, nms_thresh, indices);
+    greedyNMS(bboxes, scores, score_thresh, nms_thresh, ref_indices);
+    EXPECT_EQ(ref_indices, indices);
+
+    cv::dnn::NMSBoxes(bboxes2d, scores, score_thresh, nms_thresh, indices);
+    greedyNMS(bboxes2d, scores, score_thresh, nms_thresh, ref_indices);
+    EXPECT_EQ(ref_indices, indices);
+}
+
+TEST(BatchedNMS, ClassesAreIndependent)
+{
+    RNG& rng = theRNG();
+    const int n = 3000, num_classes = 7;
+    std::vector<Rect> bboxes;
+    std::vector<float> scores;
+    std::vector<int> class_ids;
+    for (int i = 0; i < n; i++)
+    {
+        bboxes.push_back(Rect(rng.uniform(-100, 1000), rng.uniform(-100, 1000), rng.uniform(1, 100), rng.uniform(1, 100)));
+        scores.push_back(rng.uniform(0.f, 1.f));
+        class_ids.push_back(rng.uniform(0, num_classes));
+    }
+
+    const float score_thresh = .2f, nms_thresh = .4f;
+    std::vector<int> indices;
+    cv::dnn::NMSBoxesBatched(bboxes, scores, class_ids, score_thresh, nms_thresh, indices);
+
+    // The same boxes are kept as by NMS of every class alone, in the order of scores
+    std::vector<int> ref_indices;
+    for (int c = 0; c < num_classes; c++)
+    {
+        std::vector<float> class_scores(scores);
+        for (int i = 0; i < n; i++)
+            if (class_ids[i] != c)
+                class_scores[i] = 0.f;
+        std::vector<int> class_indices;
+        cv::dnn::NMSBoxes(bboxes, class_scores, score_thresh, nms_thresh, class_indices);
+        ref_indices.insert(ref_indices.end(), class_indices.begin(), class_indices.end());
+    }
+    std::sort(ref_indices.begin(), ref_indices.end(), [&](int a, int b) {
+        return scores[a] == scores[b] ? a < b : scores[a] > scores[b];
+    });
+    EXPECT_EQ(ref_indices, indices);
+}
+
 TEST(SoftNMS, Accuracy)
 {
     //reference results are obtained using TF v2.7 tf.image.non_max_suppression_with_scores
@@ -146,6 +146,31 @@ struct GFluidParallelFor
     // - and a function to be called on the range items, designated by item index
     std::function<void(std::size_t size, std::function<void(std::size_t index)>)> parallel_for;
 };
+
+/**
+ * @brief This structure enables automatic parallel execution of the
+ * Fluid island.
+ *
+ * Fluid backend splits the island output into horizontal bands, one
+ * per thread (see cv::getNumThreads()), infers the input regions every
+ * band requires from the kernel windows and executes the bands in
+ * parallel. GFluidParallelFor can be used to specify the threading
+ * runtime.
+ *
+ * Since Fluid keeps only a few lines of every intermediate image,
+ * the memory footprint of a band doesn't depend on its height, but
+ * every band re-computes the border lines of the intermediate images.
+ * min_tile_rows limits this overhead for small images.
+ *
+ * Applies to single-island graphs whose image outputs are of the same
+ * height and is ignored if GFluidOutputRois or GFluidParallelOutputRois
+ * is specified.
+ */
+struct GFluidParallelTiling
+{
+    int max_tiles     = 0;  //!< Maximum number of bands, 0 means cv::getNumThreads()
+    int min_tile_rows = 32; //!< Minimum height of a band
+};
 /** @} gapi_compile_args */
 
 namespace detail
@@ -165,6 +190,11 @@ template<> struct CompileArgTag<GFluidParallelOutputRois>
     static const char* tag() { return "gapi.fluid.parallelOutputRois"; }
 };
 
+template<> struct CompileArgTag<GFluidParallelTiling>
+{
+    static const char* tag() { return "gapi.fluid.parallelTiling"; }
+};
+
 } // namespace detail
 
 namespace detail
@@ -412,6 +412,52 @@ struct GAPI_EXPORTS_W_SIMPLE queue_capacity
     GAPI_PROP_RW
     size_t capacity;
 };
+
+/**
+ * @brief Run the streaming pipeline on a shared worker pool.
+ *
+ * By default every pipeline step (source, island, output collector)
+ * owns a dedicated thread. With this compile argument the steps are
+ * executed as tasks on a process-wide work-stealing pool shared by
+ * all the pipelines compiled with it, and a step is scheduled only
+ * when it has data to process and space to put its results to.
+ *
+ * The pool is created by the first pipeline which uses it, so
+ * num_workers of later pipelines is ignored. Zero means the number
+ * of hardware threads.
+ */
+struct GAPI_EXPORTS_W_SIMPLE shared_pool
+{
+    GAPI_WRAP
+    explicit shared_pool(size_t workers = 0) : num_workers(workers) { }
+    GAPI_PROP_RW
+    size_t num_workers;
+};
+
+/**
+ * @brief Use lock-free ring buffers for the streaming queues.
+ *
+ * By default the pipeline steps are connected with mutex-based
+ * blocking queues. With this compile argument bounded lock-free
+ * queues are used instead (single-producer where the pipeline
+ * topology allows it, multi-producer otherwise). A thread which has
+ * to wait on such a queue spins for spin_count iterations first and
+ * only then goes to sleep.
+ *
+ * If collect_stats is set, every queue counts its occupancy and the
+ * time its elements spend inside, and reports it to the log (INFO
+ * level) when the pipeline stops.
+ */
+struct GAPI_EXPORTS_W_SIMPLE lock_free_queues
+{
+    GAPI_WRAP
+    explicit lock_free_queues(size_t spins = 1024, bool stats = false)
+        : spin_count(spins), collect_stats(stats) { }
+    GAPI_PROP_RW
+    size_t spin_count;
+    GAPI_PROP_RW
+    bool collect_stats;
+};
 } // namespace streaming
 } // namespace gapi
 
@@ -421,6 +467,16 @@ template<> struct CompileArgTag<cv::gapi::streaming::queue_capacity>
 {
     static const char* tag() { return "gapi.queue_capacity"; }
 };
+
+template<> struct CompileArgTag<cv::gapi::streaming::shared_pool>
+{
+    static const char* tag() { return "gapi.shared_pool"; }
+};
+
+template<> struct CompileArgTag<cv::gapi::streaming::lock_free_queues>
+{
+    static const char* tag() { return "gapi.lock_free_queues"; }
+};
 }
 
 /** @} gapi_main_classes */
@@ -22,6 +22,8 @@ using detail_ExtractMetaCallback    = cv::detail::ExtractMetaCallback;
 using vector_GNetParam              = std::vector<cv::gapi::GNetParam>;
 using vector_GMat                   = std::vector<cv::GMat>;
 using gapi_streaming_queue_capacity = cv::gapi::streaming::queue_capacity;
+using gapi_streaming_shared_pool    = cv::gapi::streaming::shared_pool;
+using gapi_streaming_lock_free_queues = cv::gapi::streaming::lock_free_queues;
 using GStreamerSource_OutputType    = cv::gapi::wip::GStreamerSource::OutputType;
 using map_string_and_int            = std::map<std::string, int>;
 using map_string_and_string         = std::map<std::string, std::string>;
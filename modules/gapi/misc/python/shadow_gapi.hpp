@@ -8,6 +8,8 @@ struct GAPI_EXPORTS_W_SIMPLE GCompileArg
     GAPI_WRAP GCompileArg(GKernelPackage arg);
     GAPI_WRAP GCompileArg(gapi::GNetPackage arg);
     GAPI_WRAP GCompileArg(gapi::streaming::queue_capacity arg);
+    GAPI_WRAP GCompileArg(gapi::streaming::shared_pool arg);
+    GAPI_WRAP GCompileArg(gapi::streaming::lock_free_queues arg);
     GAPI_WRAP GCompileArg(gapi::ot::ObjectTrackerParams arg);
 };
 
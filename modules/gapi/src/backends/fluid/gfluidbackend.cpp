@@ -60,6 +60,58 @@ using GConstFluidModel = ade::ConstTypedGraph
 // FluidBackend middle-layer implementation ////////////////////////////////////
 namespace
 {
+    // Splits the graph outputs into horizontal bands for GFluidParallelTiling.
+    // Returns an empty vector if the graph can't be (or is not worth to be) split.
+    std::vector<cv::GFluidOutputRois> splitOutputRows(const ade::Graph &graph,
+                                                      const cv::GFluidParallelTiling &tiling)
+    {
+        using namespace cv::gimpl;
+        GModel::ConstGraph g(graph);
+        const auto &proto = g.metadata().get<Protocol>();
+
+        // All image outputs must be of the same height to be split consistently
+        int height = -1;
+        for (const auto &nh : proto.out_nhs)
+        {
+            const auto &d = g.metadata(nh).get<Data>();
+            if (d.shape != cv::GShape::GMAT) continue;
+            const auto &desc = cv::util::get<cv::GMatDesc>(d.meta);
+            if (height != -1 && height != desc.size.height) return {};
+            height = desc.size.height;
+        }
+        if (height <= 0) return {};
+
+#if !defined(GAPI_STANDALONE)
+        const int num_threads = cv::getNumThreads();
+#else
+        const int num_threads = 1;
+#endif
+        const int max_tiles = tiling.max_tiles > 0 ? tiling.max_tiles : num_threads;
+        const int min_rows  = std::max(tiling.min_tile_rows, 1);
+        const int num_tiles = std::min(max_tiles, height / min_rows);
+        if (num_tiles <= 1) return {};
+
+        std::vector<cv::GFluidOutputRois> parallel_rois(num_tiles);
+        for (int t = 0; t < num_tiles; t++)
+        {
+            const int y0 = static_cast<int>(static_cast<int64_t>(height) *  t      / num_tiles);
+            const int y1 = static_cast<int>(static_cast<int64_t>(height) * (t + 1) / num_tiles);
+            auto &rois = parallel_rois[t].rois;
+            for (const auto &nh : proto.out_nhs)
+            {
+                const auto &d = g.metadata(nh).get<Data>();
+                if (d.shape != cv::GShape::GMAT)
+                {
+                    rois.push_back(cv::Rect{}); // Not used for non-image outputs
+                    continue;
+                }
+                const auto &desc = cv::util::get<cv::GMatDesc>(d.meta);
+                rois.push_back(cv::Rect{0, y0, desc.size.width, y1 - y0});
+            }
+        }
+        return parallel_rois;
+    }
+
     class GFluidBackendImpl final: public cv::gapi::GBackend::Priv
     {
         virtual void unpackKernel(ade::Graph            &graph,
@@ -121,10 +173,21 @@ namespace
 
             auto pfor  = gpfor.has_value() ? gpfor.value().parallel_for : default_pfor;
 
-            return parallel_out_rois.has_value() ?
-                       EPtr{new cv::gimpl::GParallelFluidExecutable (graph, graph_data, std::move(parallel_out_rois.value().parallel_rois), pfor)}
-                     : EPtr{new cv::gimpl::GFluidExecutable         (graph, graph_data, std::move(rois.rois))}
-            ;
+            if (parallel_out_rois.has_value())
+            {
+                return EPtr{new cv::gimpl::GParallelFluidExecutable (graph, graph_data, std::move(parallel_out_rois.value().parallel_rois), pfor)};
+            }
+
+            const auto tiling = cv::gapi::getCompileArg<cv::GFluidParallelTiling>(args);
+            if (tiling.has_value() && !out_rois.has_value() && num_islands == 1)
+            {
+                auto tiles_rois = splitOutputRows(graph, tiling.value());
+                if (!tiles_rois.empty())
+                {
+                    return EPtr{new cv::gimpl::GParallelFluidExecutable (graph, graph_data, std::move(tiles_rois), pfor)};
+                }
+            }
+            return EPtr{new cv::gimpl::GFluidExecutable (graph, graph_data, std::move(rois.rois))};
         }
 
         virtual void addMetaSensitiveBackendPasses(ade::ExecutionEngineSetupContext &ectx) override;
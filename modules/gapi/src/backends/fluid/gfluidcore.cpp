@@ -2034,26 +2034,31 @@ static void run_threshold(Buffer &dst, const View &src, const cv::Scalar &thresh
     DST threshd = saturate<DST>(thresh[0], roundd);
     DST maxvald = saturate<DST>(maxval[0], roundd);
 
+    int l = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    l = threshold_simd(in, out, length, thresh_, maxvald, threshd, type);
+#endif
+
     switch (type)
     {
     case cv::THRESH_BINARY:
-        for (int l=0; l < length; l++)
+        for (; l < length; l++)
             out[l] = in[l] > thresh_? maxvald: 0;
         break;
     case cv::THRESH_BINARY_INV:
-        for (int l=0; l < length; l++)
+        for (; l < length; l++)
             out[l] = in[l] > thresh_? 0: maxvald;
         break;
     case cv::THRESH_TRUNC:
-        for (int l=0; l < length; l++)
+        for (; l < length; l++)
             out[l] = in[l] > thresh_? threshd: in[l];
         break;
     case cv::THRESH_TOZERO:
-        for (int l=0; l < length; l++)
+        for (; l < length; l++)
             out[l] = in[l] > thresh_? in[l]: 0;
         break;
     case cv::THRESH_TOZERO_INV:
-        for (int l=0; l < length; l++)
+        for (; l < length; l++)
             out[l] = in[l] > thresh_? 0: in[l];
         break;
     default: CV_Error(cv::Error::StsBadArg, "unsupported threshold type");
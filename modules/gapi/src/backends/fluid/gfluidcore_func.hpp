@@ -187,6 +187,16 @@ ABSDIFFC_SIMD(float)
 
 #undef ABSDIFFC_SIMD
 
+#define THRESHOLD_SIMD(T)                                                  \
+int threshold_simd(const T in[], T out[], const int length, const T thresh, \
+                   const T maxval, const T trunc, const int type);
+
+THRESHOLD_SIMD(uchar)
+THRESHOLD_SIMD(ushort)
+THRESHOLD_SIMD(short)
+
+#undef THRESHOLD_SIMD
+
 #define DIVRC_SIMD(SRC, DST)                                           \
 int divrc_simd(const float scalar[], const SRC in[], DST out[],        \
                const int length, const int chan, const float scale);
@@ -208,6 +208,16 @@ ABSDIFFC_SIMD(float)
 
 #undef ABSDIFFC_SIMD
 
+#define THRESHOLD_SIMD(T)                                                  \
+int threshold_simd(const T in[], T out[], const int length, const T thresh, \
+                   const T maxval, const T trunc, const int type);
+
+THRESHOLD_SIMD(uchar)
+THRESHOLD_SIMD(ushort)
+THRESHOLD_SIMD(short)
+
+#undef THRESHOLD_SIMD
+
 #define DIVRC_SIMD(SRC, DST)                                           \
 int divrc_simd(const float scalar[], const SRC in[], DST out[],        \
                const int length, const int chan, const float scale);
@@ -2046,6 +2056,69 @@ ABSDIFFC_SIMD(float)
 
 #undef ABSDIFFC_SIMD
 
+//-------------------------
+//
+// Fluid kernels: Threshold
+//
+//-------------------------
+
+template<typename T>
+CV_ALWAYS_INLINE int threshold_simd_impl(const T in[], T out[], const int length, const T thresh,
+                                         const T maxval, const T trunc, const int type)
+{
+    using vec_t = vector_type_of_t<T>;
+    const int nlanes = VTraits<vec_t>::vlanes();
+
+    if (length < nlanes)
+        return 0;
+
+    const vec_t v_thresh = vx_setall<T>(thresh);
+    const vec_t v_maxval = vx_setall<T>(maxval);
+    const vec_t v_trunc  = vx_setall<T>(trunc);
+    const vec_t v_zero   = vx_setall<T>(0);
+
+    int x = 0;
+    for (;;)
+    {
+        for (; x <= length - nlanes; x += nlanes)
+        {
+            const vec_t a = vx_load(&in[x]);
+            const vec_t mask = v_gt(a, v_thresh);
+            vec_t r;
+            switch (type)
+            {
+            case cv::THRESH_BINARY:     r = v_select(mask, v_maxval, v_zero); break;
+            case cv::THRESH_BINARY_INV: r = v_select(mask, v_zero, v_maxval); break;
+            case cv::THRESH_TRUNC:      r = v_select(mask, v_trunc, a);       break;
+            case cv::THRESH_TOZERO:     r = v_select(mask, a, v_zero);        break;
+            case cv::THRESH_TOZERO_INV: r = v_select(mask, v_zero, a);        break;
+            default: return 0; // Let the caller report the error
+            }
+            vx_store(&out[x], r);
+        }
+        if (x < length)
+        {
+            x = length - nlanes;
+            continue;  // process unaligned tail
+        }
+        break;
+    }
+    return x;
+}
+
+#define THRESHOLD_SIMD(T)                                                       \
+int threshold_simd(const T in[], T out[], const int length, const T thresh,     \
+                   const T maxval, const T trunc, const int type)               \
+{                                                                               \
+    return threshold_simd_impl(in, out, length, thresh, maxval, trunc, type);   \
+}
+
+THRESHOLD_SIMD(uchar)
+THRESHOLD_SIMD(ushort)
+THRESHOLD_SIMD(short)
+
+#undef THRESHOLD_SIMD
+
 //-------------------------------------------------------------------------------------------------
 
 template<typename scale_tag_t, typename SRC, typename DST, typename Tvec>
@@ -1828,6 +1828,71 @@ GAPI_FLUID_KERNEL(GFluidBayerGR2RGB, cv::gapi::imgproc::GBayerGR2RGB, false)
     }
 };
 
+//--------------------------------------
+//
+// Fluid kernels: NV12-to-RGB, NV12-to-BGR, NV12-to-Gray
+//
+//--------------------------------------
+
+static void run_nv12torgb(const View &in_y, const View &in_uv, Buffer &out, bool bgr)
+{
+    GAPI_Assert(in_y.meta().depth  == CV_8U && in_y.meta().chan  == 1);
+    GAPI_Assert(in_uv.meta().depth == CV_8U && in_uv.meta().chan == 2);
+    GAPI_Assert(out.meta().depth   == CV_8U && out.meta().chan   == 3);
+    GAPI_Assert(out.lpi() == 2);
+
+    const int width = out.length();
+    GAPI_Assert(width % 2 == 0);
+
+    const uchar *y[2]   = { in_y.InLine<uchar>(0), in_y.InLine<uchar>(1) };
+          uchar *dst[2] = { out.OutLine<uchar>(0), out.OutLine<uchar>(1) };
+
+    run_nv12torgb_impl(dst, y, in_uv.InLine<uchar>(0), width, bgr);
+}
+
+GAPI_FLUID_KERNEL(GFluidNV12toRGB, cv::gapi::imgproc::GNV12toRGB, false)
+{
+    static const int Window = 1;
+    static const int LPI    = 2;
+    static const auto Kind  = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const View &in_y, const View &in_uv, Buffer &out)
+    {
+        run_nv12torgb(in_y, in_uv, out, false);
+    }
+};
+
+GAPI_FLUID_KERNEL(GFluidNV12toBGR, cv::gapi::imgproc::GNV12toBGR, false)
+{
+    static const int Window = 1;
+    static const int LPI    = 2;
+    static const auto Kind  = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const View &in_y, const View &in_uv, Buffer &out)
+    {
+        run_nv12torgb(in_y, in_uv, out, true);
+    }
+};
+
+GAPI_FLUID_KERNEL(GFluidNV12toGray, cv::gapi::imgproc::GNV12toGray, false)
+{
+    static const int Window = 1;
+    static const int LPI    = 2;
+    // NB: uv plane is not used, but has to be read in the same pace as for NV12toRGB
+    static const auto Kind  = cv::GFluidKernel::Kind::YUV420toRGB;
+
+    static void run(const View &in_y, const View & /* in_uv */, Buffer &out)
+    {
+        GAPI_Assert(in_y.meta().depth == CV_8U && in_y.meta().chan == 1);
+        GAPI_Assert(out.meta().depth  == CV_8U && out.meta().chan  == 1);
+
+        for (int l = 0; l < out.lpi(); l++)
+        {
+            std::copy_n(in_y.InLine<uchar>(l), out.length(), out.OutLine<uchar>(l));
+        }
+    }
+};
+
 template<typename T, typename Mapper, int chanNum>
 struct LinearScratchDesc {
     using alpha_t = typename Mapper::alpha_type;
@@ -2280,6 +2345,9 @@ cv::GKernelPackage cv::gapi::imgproc::fluid::kernels()
       , GFluidRGB2YUV422
       , GFluidRGB2HSV
       , GFluidBayerGR2RGB
+      , GFluidNV12toRGB
+      , GFluidNV12toBGR
+      , GFluidNV12toGray
     #if 0
       , GFluidCanny        -- not fluid (?)
       , GFluidEqualizeHist -- not fluid
@@ -90,6 +90,17 @@ void run_rgb2yuv422_impl(uchar out[], const uchar in[], int width)
     CV_CPU_DISPATCH(run_rgb2yuv422_impl, (out, in, width), CV_CPU_DISPATCH_MODES_ALL);
 }
 
+//--------------------------------------
+//
+// Fluid kernels: NV12-to-RGB, NV12-to-BGR
+//
+//--------------------------------------
+
+void run_nv12torgb_impl(uchar *out[2], const uchar *y[2], const uchar uv[], int width, bool bgr)
+{
+    CV_CPU_DISPATCH(run_nv12torgb_impl, (out, y, uv, width, bgr), CV_CPU_DISPATCH_MODES_ALL);
+}
+
 //-------------------------
 //
 // Fluid kernels: sepFilter
@@ -54,6 +54,14 @@ void run_yuv2rgb_impl(uchar out[], const uchar in[], int width, const float coef
 
 void run_rgb2yuv422_impl(uchar out[], const uchar in[], int width);
 
+//--------------------------------------
+//
+// Fluid kernels: NV12-to-RGB, NV12-to-BGR
+//
+//--------------------------------------
+
+void run_nv12torgb_impl(uchar *out[2], const uchar *y[2], const uchar uv[], int width, bool bgr);
+
 //-------------------------
 //
 // Fluid kernels: sepFilter
@@ -76,6 +76,14 @@ void run_yuv2rgb_impl(uchar out[], const uchar in[], int width, const float coef
 
 void run_rgb2yuv422_impl(uchar out[], const uchar in[], int width);
 
+//--------------------------------------
+//
+// Fluid kernels: NV12-to-RGB, NV12-to-BGR
+//
+//--------------------------------------
+
+void run_nv12torgb_impl(uchar *out[2], const uchar *y[2], const uchar uv[], int width, bool bgr);
+
 //-------------------------
 //
 // Fluid kernels: sepFilter
@@ -979,6 +987,114 @@ void run_rgb2yuv422_impl(uchar out[], const uchar in[], int width)
     }
 }
 
+//--------------------------------------
+//
+// Fluid kernels: NV12-to-RGB, NV12-to-BGR
+//
+//--------------------------------------
+
+// Same fixed-point BT.601 coefficients as cv::cvtColor uses, so results are bit-exact
+static const int ITUR_BT_601_CY    = 1220542;
+static const int ITUR_BT_601_CUB   = 2116026;
+static const int ITUR_BT_601_CUG   = -409993;
+static const int ITUR_BT_601_CVG   = -852492;
+static const int ITUR_BT_601_CVR   = 1673527;
+static const int ITUR_BT_601_SHIFT = 20;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+static inline void nv12torgb_simd_q(const v_int32 &y, const v_int32 &u, const v_int32 &v,
+                                    v_int32 &r, v_int32 &g, v_int32 &b)
+{
+    const v_int32 y_ = v_add(v_mul(y, vx_setall_s32(ITUR_BT_601_CY)),
+                             vx_setall_s32(1 << (ITUR_BT_601_SHIFT - 1)));
+    r = v_shr<ITUR_BT_601_SHIFT>(v_add(y_, v_mul(v, vx_setall_s32(ITUR_BT_601_CVR))));
+    g = v_shr<ITUR_BT_601_SHIFT>(v_add(y_, v_add(v_mul(v, vx_setall_s32(ITUR_BT_601_CVG)),
+                                                 v_mul(u, vx_setall_s32(ITUR_BT_601_CUG)))));
+    b = v_shr<ITUR_BT_601_SHIFT>(v_add(y_, v_mul(u, vx_setall_s32(ITUR_BT_601_CUB))));
+}
+
+// Converts nlanes pixels of a row, u and v are already duplicated for every pixel
+static inline void nv12torgb_simd(uchar out[], const v_uint8 &y, const v_uint8 &u,
+                                  const v_uint8 &v, bool bgr)
+{
+    v_int32 y0, y1, y2, y3, u0, u1, u2, u3, v0, v1, v2, v3;
+    {
+        v_uint16 yw0, yw1;
+        v_expand(v_sub(y, vx_setall_u8(16)), yw0, yw1);  // saturated, i.e. max(0, y - 16)
+        v_expand(v_reinterpret_as_s16(yw0), y0, y1);
+        v_expand(v_reinterpret_as_s16(yw1), y2, y3);
+
+        v_int16 uw0, uw1, vw0, vw1;
+        v_expand(v_reinterpret_as_s8(v_sub_wrap(u, vx_setall_u8(128))), uw0, uw1);
+        v_expand(v_reinterpret_as_s8(v_sub_wrap(v, vx_setall_u8(128))), vw0, vw1);
+        v_expand(uw0, u0, u1); v_expand(uw1, u2, u3);
+        v_expand(vw0, v0, v1); v_expand(vw1, v2, v3);
+    }
+
+    v_int32 r0, r1, r2, r3, g0, g1, g2, g3, b0, b1, b2, b3;
+    nv12torgb_simd_q(y0, u0, v0, r0, g0, b0);
+    nv12torgb_simd_q(y1, u1, v1, r1, g1, b1);
+    nv12torgb_simd_q(y2, u2, v2, r2, g2, b2);
+    nv12torgb_simd_q(y3, u3, v3, r3, g3, b3);
+
+    v_uint8 r8 = v_pack_u(v_pack(r0, r1), v_pack(r2, r3));
+    v_uint8 g8 = v_pack_u(v_pack(g0, g1), v_pack(g2, g3));
+    v_uint8 b8 = v_pack_u(v_pack(b0, b1), v_pack(b2, b3));
+
+    if (bgr)
+        v_store_interleave(out, b8, g8, r8);
+    else
+        v_store_interleave(out, r8, g8, b8);
+}
+#endif
+
+void run_nv12torgb_impl(uchar *out[2], const uchar *y[2], const uchar uv[], int width, bool bgr)
+{
+    const int bidx = bgr ? 0 : 2;
+    int w = 0;
+
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    // Every uv pair covers two pixels, so a vector of uv pairs gives two vectors of pixels
+    static const int nlanes = VTraits<v_uint8>::vlanes();
+    for ( ; w <= width - 2*nlanes; w += 2*nlanes)
+    {
+        v_uint8 u, v;
+        v_load_deinterleave(&uv[w], u, v);
+
+        v_uint8 u0, u1, v0, v1;
+        v_zip(u, u, u0, u1);
+        v_zip(v, v, v0, v1);
+
+        for (int l = 0; l < 2; l++)
+        {
+            nv12torgb_simd(&out[l][3*w],          vx_load(&y[l][w]),          u0, v0, bgr);
+            nv12torgb_simd(&out[l][3*(w + nlanes)], vx_load(&y[l][w + nlanes]), u1, v1, bgr);
+        }
+    }
+    vx_cleanup();
+#endif
+
+    for ( ; w < width; w += 2)
+    {
+        const int uu = uv[w]     - 128;
+        const int vv = uv[w + 1] - 128;
+        const int ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+        const int guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+        const int buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+
+        for (int l = 0; l < 2; l++)
+        {
+            for (int x = w; x < w + 2; x++)
+            {
+                const int yy = std::max(0, y[l][x] - 16) * ITUR_BT_601_CY;
+                out[l][3*x + 2 - bidx] = cv::saturate_cast<uchar>((yy + ruv) >> ITUR_BT_601_SHIFT);
+                out[l][3*x + 1]        = cv::saturate_cast<uchar>((yy + guv) >> ITUR_BT_601_SHIFT);
+                out[l][3*x + bidx]     = cv::saturate_cast<uchar>((yy + buv) >> ITUR_BT_601_SHIFT);
+            }
+        }
+    }
+}
+
 //-----------------------------
 //
 // Fluid kernels: sepFilter 3x3
@@ -51,6 +51,7 @@ public:
     bool try_pop(T &t);
 
     void set_capacity(std::size_t capacity);
+    std::size_t size();
 
     // Not thread-safe - as in TBB
     void clear();
@@ -116,6 +117,13 @@ void concurrent_bounded_queue<T>::set_capacity(std::size_t capacity) {
     m_capacity = capacity;
 }
 
+// Number of elements in the queue at the moment of the call
+template<typename T>
+std::size_t concurrent_bounded_queue<T>::size() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_data.size();
+}
+
 // Clear the queue. Similar to the TBB version, this method is not
 // thread-safe.
 template<typename T>
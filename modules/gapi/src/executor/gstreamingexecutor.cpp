@@ -7,6 +7,9 @@
 #include "precomp.hpp"
 
 #include <memory> // make_shared
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 #include <ade/util/zip_range.hpp>
 
@@ -27,6 +30,7 @@
 #include <logger.hpp>
 
 #include "executor/gstreamingexecutor.hpp"
+#include "executor/work_stealing_pool.hpp"
 
 #include <opencv2/gapi/streaming/meta.hpp>
 #include <opencv2/gapi/streaming/sync.hpp>
@@ -96,6 +100,9 @@ struct DataQueue {
         : q(new cv::gimpl::stream::DesyncQueue()) {
         GAPI_Assert(t == DESYNC);
     }
+    explicit DataQueue(std::shared_ptr<cv::gimpl::stream::Q> &&queue)
+        : q(std::move(queue)) {
+    }
 
     // FIXME: ADE metadata requires types to be copiable
     std::shared_ptr<cv::gimpl::stream::Q> q;
@@ -345,6 +352,7 @@ void rewindToStop(std::vector<Q*> &in_queues,
                             ", expected stop msg count: " << expected_stop_count);
     size_t got_stop_count = 0;
     while(got_stop_count < expected_stop_count) {
+        bool got_any = false;
         for (auto &&qit : ade::util::indexed(in_queues)) {
             auto id2 = ade::util::index(qit);
             auto &q2 = ade::util::value(qit);
@@ -357,6 +365,7 @@ void rewindToStop(std::vector<Q*> &in_queues,
             while (q2 && got_cmd) {
                 Cmd cmd;
                 got_cmd = q2->try_pop(cmd);
+                got_any = got_any || got_cmd;
                 if (got_cmd && cv::util::holds_alternative<Stop>(cmd)) {
                     got_stop_count ++;
                     GAPI_LOG_DEBUG(nullptr, "got stop from id: " << id2);
@@ -364,6 +373,13 @@ void rewindToStop(std::vector<Q*> &in_queues,
                 }
             }
         }
+        if (!got_any) {
+            // NB: In the shared pool mode the actors which are still
+            // to send their Stop may be waiting for a worker - let this
+            // one execute them instead of just spinning.
+            // Does nothing if running on a dedicated thread.
+            cv::gapi::own::WorkStealingPool::runPendingTask();
+        }
     }
     GAPI_LOG_DEBUG(nullptr, "completed");
 }
@@ -552,46 +568,96 @@ QueueReader::V QueueReader::getResultsVector(std::vector<Q*>        &in_queues,
 }
 
 
-// This thread is a plain dump source actor. What it do is just:
+// Common interface of the pipeline actors.
+// An actor either owns a dedicated thread which calls step() until it
+// returns false, or is stepped by the ActorScheduler on a shared pool.
+// In the latter case step() is called only when ready() returns true,
+// so the step doesn't block on its queues.
+class StreamingActor
+{
+public:
+    // Returns true if a step can be made without blocking
+    virtual bool ready() = 0;
+    // Makes a step, returns false when the actor is done
+    virtual bool step() = 0;
+    virtual ~StreamingActor() = default;
+};
+
+void actorThread(std::shared_ptr<StreamingActor> actor)
+{
+    while (actor->step()) { }
+}
+
+// This actor is a plain dump source actor. What it do is just:
 // - Check input queue (the only one) for a control command
 // - Depending on the state, obtains next data object and pushes it to the
 //   pipeline.
-void emitterActorThread(std::shared_ptr<cv::gimpl::GIslandEmitter> emitter,
-                        Q& in_queue,
-                        std::vector<Q*> out_queues,
-                        std::function<void()> cb_completion)
+class EmitterActor final: public StreamingActor
 {
-    // Wait for the explicit Start command.
-    // ...or Stop command, this also happens.
-    Cmd cmd;
-    in_queue.pop(cmd);
-    GAPI_Assert(   cv::util::holds_alternative<Start>(cmd)
-                || cv::util::holds_alternative<Stop>(cmd));
-    if (cv::util::holds_alternative<Stop>(cmd))
+    std::shared_ptr<cv::gimpl::GIslandEmitter> m_emitter;
+    Q& m_in_queue;
+    std::vector<Q*> m_out_queues;
+    std::function<void()> m_cb_completion;
+    bool m_started = false;
+
+public:
+    EmitterActor(std::shared_ptr<cv::gimpl::GIslandEmitter> emitter,
+                 Q& in_queue,
+                 std::vector<Q*> out_queues,
+                 std::function<void()> cb_completion)
+        : m_emitter(std::move(emitter))
+        , m_in_queue(in_queue)
+        , m_out_queues(std::move(out_queues))
+        , m_cb_completion(std::move(cb_completion))
     {
-        for (auto &&oq : out_queues) {
-            oq->push(cmd);
-        }
-        return;
     }
 
-    GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_hndl, "emitter");
-    GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_pull_hndl, "emitter_pull");
-    GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_push_hndl, "emitter_push");
+    virtual bool ready() override
+    {
+        if (!m_started) {
+            return !m_in_queue.empty();
+        }
+        // NB: Stop is also broadcasted to the output queues,
+        // so wait for the space even if it is pending.
+        return !ade::util::any_of(m_out_queues, [](Q *q){ return q->full(); });
+    }
 
-    // Now start emitting the data from the source to the pipeline.
-    while (true)
+    virtual bool step() override
     {
+        if (!m_started)
+        {
+            // Wait for the explicit Start command.
+            // ...or Stop command, this also happens.
+            Cmd cmd;
+            m_in_queue.pop(cmd);
+            GAPI_Assert(   cv::util::holds_alternative<Start>(cmd)
+                        || cv::util::holds_alternative<Stop>(cmd));
+            if (cv::util::holds_alternative<Stop>(cmd))
+            {
+                for (auto &&oq : m_out_queues) {
+                    oq->push(cmd);
+                }
+                return false;
+            }
+            m_started = true;
+            return true;
+        }
+
+        GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_hndl, "emitter");
+        GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_pull_hndl, "emitter_pull");
+        GAPI_ITT_STATIC_LOCAL_HANDLE(emitter_push_hndl, "emitter_push");
+
+        // Now emit the next data chunk from the source to the pipeline.
         GAPI_ITT_AUTO_TRACE_GUARD(emitter_hndl);
 
         Cmd cancel;
-        if (in_queue.try_pop(cancel))
+        if (m_in_queue.try_pop(cancel))
         {
             // if we just popped a cancellation command...
             GAPI_Assert(cv::util::holds_alternative<Stop>(cancel));
             // Broadcast it to the readers and quit.
-            for (auto &&oq : out_queues) oq->push(cancel);
-            return;
+            for (auto &&oq : m_out_queues) oq->push(cancel);
+            return false;
         }
 
         // Try to obtain next data chunk from the source
@@ -601,23 +667,23 @@ void emitterActorThread(std::shared_ptr<cv::gimpl::GIslandEmitter> emitter,
         try {
             result = [&](){
                 GAPI_ITT_AUTO_TRACE_GUARD(emitter_pull_hndl);
-                return emitter->pull(data);
+                return m_emitter->pull(data);
             }();
         } catch (...) {
-           auto eptr = std::current_exception();
-           for (auto &&oq : out_queues)
-           {
-               oq->push(Cmd{cv::gimpl::Exception{eptr}});
-           }
-           // NB: Go to the next iteration.
-           continue;
-       }
+            auto eptr = std::current_exception();
+            for (auto &&oq : m_out_queues)
+            {
+                oq->push(Cmd{cv::gimpl::Exception{eptr}});
+            }
+            // NB: Go to the next step.
+            return true;
+        }
 
         if (result)
         {
             GAPI_ITT_AUTO_TRACE_GUARD(emitter_push_hndl);
             // // On success, broadcast it to our readers
-            for (auto &&oq : out_queues)
+            for (auto &&oq : m_out_queues)
             {
                 // FIXME: FOR SOME REASON, oq->push(Cmd{data}) doesn't work!!
                 // empty mats are arrived to the receivers!
@@ -625,17 +691,16 @@ void emitterActorThread(std::shared_ptr<cv::gimpl::GIslandEmitter> emitter,
                 const auto tmp = data;
                 oq->push(Cmd{tmp});
             }
+            return true;
         }
-        else
-        {
-            // Otherwise, broadcast STOP message to our readers and quit.
-            // This usually means end-of-stream, so trigger a callback
-            for (auto &&oq : out_queues) oq->push(Cmd{Stop{}});
-            if (cb_completion) cb_completion();
-            return;
-        }
+
+        // Otherwise, broadcast STOP message to our readers and quit.
+        // This usually means end-of-stream, so trigger a callback
+        for (auto &&oq : m_out_queues) oq->push(Cmd{Stop{}});
+        if (m_cb_completion) m_cb_completion();
+        return false;
     }
-}
+};
 
 // This thread pulls data from the assigned input queues and makes sure that
 // all input args are in sync (timestamps are equal), dropping some inputs if required.
@@ -1024,83 +1089,146 @@ public:
     }
 };
 
-// This thread is a plain dumb processing actor. What it do is just:
+// This actor is a plain dumb processing actor. What it do is just:
 // - Reads input from the input queue(s), sleeps if there's nothing to read
 // - Once a full input vector is obtained, passes it to the underlying island
 //   executable for processing.
 // - Pushes processing results down to consumers - to the subsequent queues.
 //   Note: Every data object consumer has its own queue.
-void islandActorThread(std::vector<cv::gimpl::RcDesc> in_rcs,                     // FIXME: this is...
-                       std::vector<cv::gimpl::RcDesc> out_rcs,                    // FIXME: ...basically just...
-                       cv::GMetaArgs out_metas,                                   // ...
-                       std::shared_ptr<cv::gimpl::GIslandExecutable> island_exec, // FIXME: ...a copy of OpDesc{}.
-                       std::vector<Q*> in_queues,
-                       cv::GRunArgs in_constants,
-                       std::vector< std::vector<Q*> > out_queues,
-                       const std::string& island_meta_info)
+class IslandActor final: public StreamingActor
 {
-    GAPI_Assert(in_queues.size() == in_rcs.size());
-    GAPI_Assert(out_queues.size() == out_rcs.size());
-    GAPI_Assert(out_queues.size() == out_metas.size());
-    QueueReader qr;
-    StreamingInput input(qr, in_queues, in_constants, in_rcs);
-    StreamingOutput output(out_metas, out_queues, out_rcs, island_exec);
-
-    GAPI_ITT_DYNAMIC_LOCAL_HANDLE(island_hndl, island_meta_info.c_str());
-    while (!output.done())
+    std::shared_ptr<cv::gimpl::GIslandExecutable> m_island_exec;
+    std::vector<Q*> m_in_queues;
+    cv::GRunArgs m_in_constants;
+    std::vector< std::vector<Q*> > m_out_queues;
+    cv::GMetaArgs m_out_metas;
+    QueueReader m_qr;
+    StreamingInput m_input;
+    StreamingOutput m_output;
+    std::string m_island_meta_info;
+
+public:
+    IslandActor(const std::vector<cv::gimpl::RcDesc> &in_rcs,                     // FIXME: this is...
+                const std::vector<cv::gimpl::RcDesc> &out_rcs,                    // FIXME: ...basically just...
+                const cv::GMetaArgs &out_metas,                                   // ...
+                std::shared_ptr<cv::gimpl::GIslandExecutable> island_exec,        // FIXME: ...a copy of OpDesc{}.
+                std::vector<Q*> in_queues,
+                cv::GRunArgs in_constants,
+                std::vector< std::vector<Q*> > out_queues,
+                const std::string& island_meta_info)
+        : m_island_exec(island_exec)
+        , m_in_queues(std::move(in_queues))
+        , m_in_constants(std::move(in_constants))
+        , m_out_queues(std::move(out_queues))
+        , m_out_metas(out_metas)
+        , m_input(m_qr, m_in_queues, m_in_constants, in_rcs)
+        , m_output(m_out_metas, m_out_queues, out_rcs, island_exec)
+        , m_island_meta_info(island_meta_info)
     {
+        GAPI_Assert(m_in_queues.size() == in_rcs.size());
+        GAPI_Assert(m_out_queues.size() == out_rcs.size());
+        GAPI_Assert(m_out_queues.size() == out_metas.size());
+    }
+
+    virtual bool ready() override
+    {
+        // NB: Asynchronous islands may complete their work in a callback,
+        // let the actor finish in this case.
+        if (m_output.done()) {
+            return true;
+        }
+        // Null queues are graph constants, always available
+        const bool has_input = ade::util::all_of(m_in_queues, [](Q *q) {
+            return q == nullptr || !q->empty();
+        });
+        const bool has_space = !ade::util::any_of(m_out_queues, [](const std::vector<Q*> &qs) {
+            return ade::util::any_of(qs, [](Q *q){ return q->full(); });
+        });
+        return has_input && has_space;
+    }
+
+    virtual bool step() override
+    {
+        if (m_output.done()) {
+            return false;
+        }
+
+        GAPI_ITT_DYNAMIC_LOCAL_HANDLE(island_hndl, m_island_meta_info.c_str());
         GAPI_ITT_AUTO_TRACE_GUARD(island_hndl);
         // NB: In case the input message is an cv::gimpl::Exception
         // handle it in a general way.
-        if (cv::util::holds_alternative<cv::gimpl::Exception>(input.read()))
+        if (cv::util::holds_alternative<cv::gimpl::Exception>(m_input.read()))
         {
-            auto in_msg = input.get();
-            output.post(std::move(cv::util::get<cv::gimpl::Exception>(in_msg)));
+            auto in_msg = m_input.get();
+            m_output.post(std::move(cv::util::get<cv::gimpl::Exception>(in_msg)));
         }
         else
         {
-            island_exec->run(input, output);
+            m_island_exec->run(m_input, m_output);
         }
+        return !m_output.done();
     }
-}
+};
 
-// The idea of collectorThread is easy.  If there're multiple outputs
+// The idea of CollectorActor is easy.  If there're multiple outputs
 // in the graph, we need to pull an object from every associated queue
 // and then put the resulting vector into one single queue.  While it
 // looks redundant, it simplifies dramatically the way how try_pull()
 // is implemented - we need to check one queue instead of many.
 //
-// After desync() is added, there may be multiple collector threads
-// running, every thread producing its own part of the partial
+// After desync() is added, there may be multiple collector actors
+// running, every actor producing its own part of the partial
 // pipeline output (optional<T>...). All partial outputs are pushed
 // to the same output queue and then picked by GStreamingExecutor
 // in the end.
-void collectorThread(std::vector<Q*>   in_queues,
-                     std::vector<int>  in_mapping,
-                     const std::size_t out_size,
-                     const bool        handle_stop,
-                     Q&                out_queue)
+class CollectorActor final: public StreamingActor
 {
-    // These flags are static now: regardless if the sync or
-    // desync branch is collected by this thread, all in_queue
-    // data should come in sync.
-    std::vector<bool> flags(out_size, false);
-    for (auto idx : in_mapping) {
-        flags[idx] = true;
+    std::vector<Q*>   m_in_queues;
+    std::vector<int>  m_in_mapping;
+    const std::size_t m_out_size;
+    const bool        m_handle_stop;
+    Q&                m_out_queue;
+    std::vector<bool> m_flags;
+    QueueReader       m_qr;
+
+public:
+    CollectorActor(std::vector<Q*>   in_queues,
+                   std::vector<int>  in_mapping,
+                   const std::size_t out_size,
+                   const bool        handle_stop,
+                   Q&                out_queue)
+        : m_in_queues(std::move(in_queues))
+        , m_in_mapping(std::move(in_mapping))
+        , m_out_size(out_size)
+        , m_handle_stop(handle_stop)
+        , m_out_queue(out_queue)
+        , m_flags(out_size, false)
+    {
+        // These flags are static now: regardless if the sync or
+        // desync branch is collected by this actor, all in_queue
+        // data should come in sync.
+        for (auto idx : m_in_mapping) {
+            m_flags[idx] = true;
+        }
     }
 
-    GAPI_ITT_STATIC_LOCAL_HANDLE(collector_hndl, "collector");
-    GAPI_ITT_STATIC_LOCAL_HANDLE(collector_get_results_hndl, "collector_get_results");
-    GAPI_ITT_STATIC_LOCAL_HANDLE(collector_push_hndl, "collector_push");
+    virtual bool ready() override
+    {
+        return ade::util::all_of(m_in_queues, [](Q *q){ return !q->empty(); })
+            && !m_out_queue.full();
+    }
 
-    QueueReader qr;
-    while (true)
+    virtual bool step() override
     {
+        GAPI_ITT_STATIC_LOCAL_HANDLE(collector_hndl, "collector");
+        GAPI_ITT_STATIC_LOCAL_HANDLE(collector_get_results_hndl, "collector_get_results");
+        GAPI_ITT_STATIC_LOCAL_HANDLE(collector_push_hndl, "collector_push");
+
         GAPI_ITT_AUTO_TRACE_GUARD(collector_hndl);
 
         const auto result = [&](){
             GAPI_ITT_AUTO_TRACE_GUARD(collector_get_results_hndl);
-            return qr.getResultsVector(in_queues, in_mapping, out_size);
+            return m_qr.getResultsVector(m_in_queues, m_in_mapping, m_out_size);
         }();
 
         switch (result.index())
@@ -1109,24 +1237,23 @@ void collectorThread(std::vector<Q*>   in_queues,
             {
                 GAPI_ITT_AUTO_TRACE_GUARD(collector_push_hndl);
                 auto this_result = cv::util::get<cv::GRunArgs>(result);
-                out_queue.push(Cmd{Result{std::move(this_result), flags}});
-                break;
+                m_out_queue.push(Cmd{Result{std::move(this_result), m_flags}});
+                return true;
             }
             case QueueReader::V::index_of<Stop>():
-                if (handle_stop)
+                if (m_handle_stop)
                 {
-                    out_queue.push(Cmd{Stop{}});
+                    m_out_queue.push(Cmd{Stop{}});
                 }
-                // Terminate the thread anyway
-                return;
+                // Terminate the actor anyway
+                return false;
             case QueueReader::V::index_of<cv::gimpl::Exception>():
-                out_queue.push(Cmd{cv::util::get<cv::gimpl::Exception>(result)});
-                break;
-            default:
-                GAPI_Error("Unreachable code");
+                m_out_queue.push(Cmd{cv::util::get<cv::gimpl::Exception>(result)});
+                return true;
         }
+        GAPI_Error("Unreachable code");
     }
-}
+};
 
 void check_DesyncObjectConsumedByMultipleIslands(const cv::gimpl::GIslandModel::Graph &gim) {
     using namespace cv::gimpl;
@@ -1292,6 +1419,114 @@ public:
     }
 };
 
+// Runs the pipeline actors on a shared WorkStealingPool.
+// An actor is scheduled only when it is ready() to make a step, and
+// only one step of an actor is in flight at a time. Every queue the
+// actors use notifies the scheduler on push/pop, so all the actors
+// are re-checked whenever something has changed in the pipeline.
+class cv::gimpl::GStreamingExecutor::ActorScheduler final {
+    struct Task {
+        std::shared_ptr<StreamingActor> actor;
+        std::atomic<bool> owned{false};   // step is scheduled or ready() is being checked
+        std::atomic<bool> recheck{false}; // ready() may have changed since the last check
+        bool finished = false;
+    };
+
+    cv::gapi::own::WorkStealingPool& m_pool;
+    std::vector<std::unique_ptr<Task>> m_tasks;
+
+    // Number of actors not finished yet and number of the
+    // notifications and steps currently in progress
+    std::size_t m_alive = 0u;
+    std::size_t m_inflight = 0u;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+
+    void release() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (--m_inflight == 0u && m_alive == 0u) {
+            m_cv.notify_all();
+        }
+    }
+
+    void tryRun(Task &t) {
+        t.recheck = true;
+        while (t.recheck) {
+            if (t.owned.exchange(true)) {
+                // Somebody else checks or runs this actor,
+                // it will see the recheck flag
+                return;
+            }
+            t.recheck = false;
+            if (!t.finished && t.actor->ready()) {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    ++m_inflight;
+                }
+                m_pool.schedule([this, &t](){ run(t); });
+                return;
+            }
+            t.owned = false;
+        }
+    }
+
+    void run(Task &t) {
+        if (!t.actor->step()) {
+            // Keep the actor owned forever so it is never scheduled again
+            t.finished = true;
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                --m_alive;
+            }
+        } else {
+            t.owned = false;
+        }
+        kick();
+        release();
+    }
+
+    void kick() {
+        for (auto &t : m_tasks) {
+            tryRun(*t);
+        }
+    }
+
+public:
+    explicit ActorScheduler(cv::gapi::own::WorkStealingPool &pool)
+        : m_pool(pool) {
+    }
+
+    // Not thread-safe, actors are added when the pipeline is idle
+    void add(std::shared_ptr<StreamingActor> &&actor) {
+        m_tasks.emplace_back(new Task());
+        m_tasks.back()->actor = std::move(actor);
+        std::lock_guard<std::mutex> lock{m_mutex};
+        ++m_alive;
+    }
+
+    // Called by the queues on every change
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            if (m_alive == 0u) {
+                return;
+            }
+            ++m_inflight;
+        }
+        kick();
+        release();
+    }
+
+    // Waits until all the actors are finished
+    void join() {
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            m_cv.wait(lock, [this](){ return m_alive == 0u && m_inflight == 0u; });
+        }
+        m_tasks.clear();
+    }
+};
+
 // GStreamingExecutor expects compile arguments as input to have possibility to do
 // proper graph reshape and islands recompilation
 cv::gimpl::GStreamingExecutor::GStreamingExecutor(std::unique_ptr<ade::Graph> &&g_model,
@@ -1330,6 +1565,24 @@ cv::gimpl::GStreamingExecutor::GStreamingExecutor(std::unique_ptr<ade::Graph> &&
                        .value_or(cv::gapi::streaming::sync_policy::dont_sync);
     m_sync.reset(new Synchronizer(sync_policy, *m_island_graph, queue_capacity));
 
+    // Every queue between the pipeline steps has a single producer,
+    // so the lock-free mode uses SPSC ring buffers there
+    auto lock_free = cv::gapi::getCompileArg<cv::gapi::streaming::lock_free_queues>(m_comp_args);
+    auto make_data_queue = [&lock_free](std::size_t capacity) {
+        return lock_free
+            ? DataQueue(std::make_shared<stream::SpscQueue>(capacity,
+                                                            lock_free->spin_count,
+                                                            lock_free->collect_stats))
+            : DataQueue(capacity);
+    };
+
+    auto has_shared_pool = cv::gapi::getCompileArg<cv::gapi::streaming::shared_pool>(m_comp_args);
+    if (has_shared_pool) {
+        auto &pool = cv::gapi::own::WorkStealingPool::shared(
+            static_cast<uint32_t>(has_shared_pool->num_workers));
+        m_scheduler.reset(new ActorScheduler(pool));
+    }
+
     // If metadata was not passed to compileStreaming, Islands are not compiled at this point.
     // It is fine -- Islands are then compiled in setSource (at the first valid call).
     const bool islands_compiled = m_gim.metadata().contains<IslandsCompiled>();
@@ -1415,9 +1668,9 @@ cv::gimpl::GStreamingExecutor::GStreamingExecutor(std::unique_ptr<ade::Graph> &&
                         } else if (qgr.metadata(eh).contains<DesyncSpecialCase>()) {
                             // See comment below
                             // Limit queue size to 1 in this case
-                            qgr.metadata(eh).set(DataQueue(1u));
+                            qgr.metadata(eh).set(make_data_queue(1u));
                         } else {
-                            qgr.metadata(eh).set(DataQueue(queue_capacity));
+                            qgr.metadata(eh).set(make_data_queue(queue_capacity));
                         }
                         m_internal_queues.insert(qgr.metadata(eh).get<DataQueue>().q.get());
                     }
@@ -1475,7 +1728,7 @@ cv::gimpl::GStreamingExecutor::GStreamingExecutor(std::unique_ptr<ade::Graph> &&
                 // Also initialize Sink's input queue
                 ade::TypedGraph<DataQueue> qgr(*m_island_graph);
                 GAPI_Assert(nh->inEdges().size() == 1u);
-                qgr.metadata(nh->inEdges().front()).set(DataQueue(queue_capacity));
+                qgr.metadata(nh->inEdges().front()).set(make_data_queue(queue_capacity));
                 m_sink_queues[sink_idx] = qgr.metadata(nh->inEdges().front()).get<DataQueue>().q.get();
 
                 // Assign a desync tag
@@ -1507,7 +1760,21 @@ cv::gimpl::GStreamingExecutor::GStreamingExecutor(std::unique_ptr<ade::Graph> &&
     // of desync parts (they can generate output individually
     // per the same input frame, so the output traffic multiplies)
     GAPI_Assert(m_collector_map.size() > 0u);
-    m_out_queue.set_capacity(queue_capacity * m_collector_map.size());
+    const auto out_queue_capacity = queue_capacity * m_collector_map.size();
+    if (lock_free && m_collector_map.size() > 1u) {
+        // Every collector pushes to the final queue
+        m_out_queue.reset(new stream::MpscQueue(out_queue_capacity,
+                                                lock_free->spin_count,
+                                                lock_free->collect_stats));
+    } else if (lock_free) {
+        m_out_queue.reset(new stream::SpscQueue(out_queue_capacity,
+                                                lock_free->spin_count,
+                                                lock_free->collect_stats));
+    } else {
+        auto out_queue = new stream::SyncQueue();
+        out_queue->set_capacity(out_queue_capacity);
+        m_out_queue.reset(out_queue);
+    }
 
     // FIXME: The code duplicates logic of collectGraphInfo()
     cv::gimpl::GModel::ConstGraph cgr(*m_orig_graph);
@@ -1666,6 +1933,27 @@ void cv::gimpl::GStreamingExecutor::setSource(GRunArgs &&ins)
         stop();
     }
 
+    // Actors either get their own threads or are run by the scheduler
+    // which is woken up on any change in the actor's queues
+    auto run_actor = [this](std::shared_ptr<StreamingActor> &&actor,
+                            const std::vector<stream::Q*> &in_queues,
+                            const std::vector<stream::Q*> &out_queues)
+    {
+        if (!m_scheduler)
+        {
+            m_threads.emplace_back(actorThread, std::move(actor));
+            return;
+        }
+        ActorScheduler *scheduler = m_scheduler.get();
+        for (auto *q : in_queues) {
+            if (q) q->set_listener([scheduler](){ scheduler->notify(); });
+        }
+        for (auto *q : out_queues) {
+            q->set_listener([scheduler](){ scheduler->notify(); });
+        }
+        m_scheduler->add(std::move(actor));
+    };
+
     for (auto it : ade::util::indexed(m_emitters))
     {
         const auto id = ade::util::index(it); // = index in GComputation's protocol
@@ -1677,11 +1965,12 @@ void cv::gimpl::GStreamingExecutor::setSource(GRunArgs &&ins)
         // Collect all reader queues from the emitter's the only output object
         auto out_queues = m_sync->outQueues(eh);
 
-        m_threads.emplace_back(emitterActorThread,
-                               emitter,
-                               std::ref(m_emitter_queues[id]),
-                               out_queues,
-                               real_video_completion_cb);
+        run_actor(std::make_shared<EmitterActor>(emitter,
+                                                 m_emitter_queues[id],
+                                                 out_queues,
+                                                 real_video_completion_cb),
+                  {&m_emitter_queues[id]},
+                  out_queues);
     }
 
     m_sync->start();
@@ -1712,15 +2001,20 @@ void cv::gimpl::GStreamingExecutor::setSource(GRunArgs &&ins)
         // Notify island executable about a new stream to let it update its internal variables.
         op.isl_exec->handleNewStream();
 
-        m_threads.emplace_back(islandActorThread,
-                               op.in_objects,
-                               op.out_objects,
-                               op.out_metas,
-                               island_exec,
-                               in_queues,
-                               op.in_constants,
-                               out_queues,
-                               island_meta_info);
+        std::vector<stream::Q*> all_out_queues;
+        for (auto &&qs : out_queues) {
+            all_out_queues.insert(all_out_queues.end(), qs.begin(), qs.end());
+        }
+        run_actor(std::make_shared<IslandActor>(op.in_objects,
+                                                op.out_objects,
+                                                op.out_metas,
+                                                island_exec,
+                                                in_queues,
+                                                op.in_constants,
+                                                out_queues,
+                                                island_meta_info),
+                  in_queues,
+                  all_out_queues);
     }
 
     // Finally, start collector thread(s).
@@ -1730,12 +2024,13 @@ void cv::gimpl::GStreamingExecutor::setSource(GRunArgs &&ins)
     const bool has_main_path = m_sink_sync.end() !=
         std::find(m_sink_sync.begin(), m_sink_sync.end(), -1);
     for (auto &&info : m_collector_map) {
-        m_threads.emplace_back(collectorThread,
-                               info.second.queues,
-                               info.second.mapping,
-                               m_sink_queues.size(),
-                               has_main_path ? info.first == -1 : true, // see below (*)
-                               std::ref(m_out_queue));
+        run_actor(std::make_shared<CollectorActor>(info.second.queues,
+                                                   info.second.mapping,
+                                                   m_sink_queues.size(),
+                                                   has_main_path ? info.first == -1 : true, // see below (*)
+                                                   *m_out_queue),
+                  info.second.queues,
+                  {m_out_queue.get()});
 
         // (*) - there may be a problem with desynchronized paths when those work
         // faster than the main path. In this case, the desync paths get "Stop" message
@@ -1771,6 +2066,7 @@ void cv::gimpl::GStreamingExecutor::wait_shutdown()
     // FIXME: Of course it can be designed much better
     for (auto &t : m_threads) t.join();
     m_threads.clear();
+    if (m_scheduler) m_scheduler->join();
     m_sync->join();
 
     // Clear all queues
@@ -1780,12 +2076,28 @@ void cv::gimpl::GStreamingExecutor::wait_shutdown()
     // It usually happens when there's multiple inputs,
     // one constant and one is not, and the latter ends (e.g.
     // with end-of-stream).
+    // Report the queue counters of the finished run (if collected)
+    auto report = [](const char *kind, stream::Q *q) {
+        const auto s = q->stats();
+        if (s.has_value()) {
+            GAPI_LOG_INFO(NULL, kind << " queue " << q
+                          << ": pushed " << s->pushed
+                          << ", occupancy avg " << s->avg_occupancy
+                          << " max " << s->max_occupancy
+                          << ", latency (us) avg " << s->avg_latency_us
+                          << " max " << s->max_latency_us);
+        }
+    };
+    for (auto &q : m_internal_queues) report("Internal", q);
+    for (auto &q : m_sink_queues) report("Sink", q);
+    report("Output", m_out_queue.get());
+
     for (auto &q : m_emitter_queues) q.clear();
     for (auto &q : m_sink_queues) q->clear();
     for (auto &q : m_internal_queues) q->clear();
     m_const_emitter_queues.clear();
     m_const_vals.clear();
-    m_out_queue.clear();
+    m_out_queue->clear();
     m_sync->clear();
 
     for (auto &&op : m_ops) {
@@ -1812,7 +2124,7 @@ bool cv::gimpl::GStreamingExecutor::pull(cv::GRunArgsP &&outs)
                 "Number of data objects in cv::gout() must match the number of graph outputs in cv::GOut()");
 
     Cmd cmd;
-    m_out_queue.pop(cmd);
+    m_out_queue->pop(cmd);
     switch (cmd.index()) {
         case Cmd::index_of<Stop>():
             wait_shutdown();
@@ -1847,7 +2159,7 @@ bool cv::gimpl::GStreamingExecutor::pull(cv::GOptRunArgsP &&outs)
                 "Number of data objects in cv::gout() must match the number of graph outputs in cv::GOut()");
 
     Cmd cmd;
-    m_out_queue.pop(cmd);
+    m_out_queue->pop(cmd);
     switch (cmd.index()) {
         case Cmd::index_of<Stop>():
             wait_shutdown();
@@ -1898,7 +2210,7 @@ bool cv::gimpl::GStreamingExecutor::try_pull(cv::GRunArgsP &&outs)
     GAPI_Assert(m_sink_queues.size() == outs.size());
 
     Cmd cmd;
-    if (!m_out_queue.try_pop(cmd)) {
+    if (!m_out_queue->try_pop(cmd)) {
         return false;
     }
     if (cv::util::holds_alternative<Stop>(cmd))
@@ -1936,7 +2248,7 @@ void cv::gimpl::GStreamingExecutor::stop()
     Cmd cmd;
     while (!cv::util::holds_alternative<Stop>(cmd))
     {
-        m_out_queue.pop(cmd);
+        m_out_queue->pop(cmd);
     }
     GAPI_Assert(cv::util::holds_alternative<Stop>(cmd));
     wait_shutdown();
@@ -14,6 +14,9 @@
 
 #include <thread> // thread
 #include <vector>
+#include <functional> // function
+#include <chrono>
+#include <atomic>
 #include <unordered_map>
 
 #if defined(HAVE_TBB)
@@ -24,6 +27,9 @@ template<typename T> using QueueClass = tbb::concurrent_bounded_queue<T>;
 template<typename T> using QueueClass = cv::gapi::own::concurrent_bounded_queue<T>;
 #endif // TBB
 #include "executor/last_value.hpp"
+#include "executor/lock_free_queue.hpp"
+
+#include <opencv2/gapi/util/optional.hpp>
 
 #include "executor/gabstractstreamingexecutor.hpp"
 
@@ -54,6 +60,15 @@ using Cmd = cv::util::variant
     , cv::gimpl::Exception // Exception which is thrown while execution.
    >;
 
+// Occupancy and latency counters of a queue
+struct QueueStats {
+    std::size_t pushed = 0u;
+    std::size_t max_occupancy = 0u;
+    double avg_occupancy  = 0.; // Average number of elements found by push()
+    double avg_latency_us = 0.; // Average time between push() and pop() of an element
+    double max_latency_us = 0.;
+};
+
 // Interface over a queue. The underlying queue implementation may be
 // different. This class is mainly introduced to bring some
 // abstraction over the real queues (bounded in-order) and a
@@ -66,20 +81,48 @@ public:
     virtual void pop(Cmd &cmd) = 0;
     virtual bool try_pop(Cmd &cmd) = 0;
     virtual void clear() = 0;
+    // Used to check if an actor can make a step without blocking
+    virtual bool empty() = 0;
+    virtual bool full() = 0;
+    // Returns an empty optional if the queue doesn't collect stats
+    virtual cv::util::optional<QueueStats> stats() { return {}; }
     virtual ~Q() = default;
+
+    // Listener is called after every push and every successful pop.
+    // Used to wake up the actors when they run on a shared pool.
+    // Not thread-safe, must be set when the queue is not in use.
+    void set_listener(std::function<void()> l) { m_listener = std::move(l); }
+
+protected:
+    void notify() { if (m_listener) m_listener(); }
+
+private:
+    std::function<void()> m_listener;
 };
 
 // A regular queue implementation
 class SyncQueue final: public Q {
     QueueClass<Cmd> m_q;    // FIXME: OWN or WRAP??
+    std::size_t m_capacity = 0u;
+
+    // NB: TBB's size() is signed and can be negative if there are waiting consumers
+    std::ptrdiff_t size() { return static_cast<std::ptrdiff_t>(m_q.size()); }
 
 public:
-    virtual void push(const Cmd &cmd) override { m_q.push(cmd); }
-    virtual void pop(Cmd &cmd)        override { m_q.pop(cmd);  }
-    virtual bool try_pop(Cmd &cmd)    override { return m_q.try_pop(cmd); }
+    virtual void push(const Cmd &cmd) override { m_q.push(cmd); notify(); }
+    virtual void pop(Cmd &cmd)        override { m_q.pop(cmd);  notify(); }
+    virtual bool try_pop(Cmd &cmd)    override {
+        const bool popped = m_q.try_pop(cmd);
+        if (popped) notify();
+        return popped;
+    }
     virtual void clear()              override { m_q.clear(); }
+    virtual bool empty()              override { return size() <= 0; }
+    virtual bool full()               override {
+        return m_capacity != 0u && size() >= static_cast<std::ptrdiff_t>(m_capacity);
+    }
 
-    void set_capacity(std::size_t c) { m_q.set_capacity(c);}
+    void set_capacity(std::size_t c) { m_q.set_capacity(c); m_capacity = c; }
 };
 
 // Desynchronized "queue" implementation
@@ -90,12 +133,129 @@ class DesyncQueue final: public Q {
     cv::gapi::own::last_written_value<Cmd> m_v;
 
 public:
-    virtual void push(const Cmd &cmd) override { m_v.push(cmd); }
-    virtual void pop(Cmd &cmd)        override { m_v.pop(cmd);  }
-    virtual bool try_pop(Cmd &cmd)    override { return m_v.try_pop(cmd); }
+    virtual void push(const Cmd &cmd) override { m_v.push(cmd); notify(); }
+    virtual void pop(Cmd &cmd)        override { m_v.pop(cmd);  notify(); }
+    virtual bool try_pop(Cmd &cmd)    override {
+        const bool popped = m_v.try_pop(cmd);
+        if (popped) notify();
+        return popped;
+    }
     virtual void clear()              override { m_v.clear(); }
+    virtual bool empty()              override { return m_v.empty(); }
+    virtual bool full()               override { return false; } // push never blocks
 };
 
+// Lock-free queue implementation (see cv::gapi::streaming::lock_free_queues)
+// Ring is either a single-producer or a multi-producer bounded ring buffer.
+// Both expect a single consumer.
+template<template<typename> class Ring>
+class LockFreeQueue final: public Q {
+    struct Entry {
+        Cmd cmd;
+        int64_t push_ts = 0; // ns, set only if stats are collected
+    };
+    Ring<Entry> m_ring;
+    const bool m_collect_stats;
+
+    std::atomic<std::size_t> m_pushed{0u};
+    std::atomic<std::size_t> m_occupancy_sum{0u};
+    std::atomic<std::size_t> m_max_occupancy{0u};
+    std::atomic<std::size_t> m_popped{0u};
+    std::atomic<int64_t>     m_latency_sum{0};
+    std::atomic<int64_t>     m_max_latency{0};
+
+    static int64_t now() {
+        using namespace std::chrono;
+        return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    template<typename V>
+    static void update_max(std::atomic<V> &max, const V v) {
+        V prev = max.load(std::memory_order_relaxed);
+        while (prev < v && !max.compare_exchange_weak(prev, v, std::memory_order_relaxed)) { }
+    }
+
+    void on_push(Entry &e) {
+        if (!m_collect_stats) return;
+        e.push_ts = now();
+        const std::size_t occupancy = m_ring.size();
+        m_pushed.fetch_add(1u, std::memory_order_relaxed);
+        m_occupancy_sum.fetch_add(occupancy, std::memory_order_relaxed);
+        update_max(m_max_occupancy, occupancy);
+    }
+
+    void on_pop(const Entry &e) {
+        if (!m_collect_stats) return;
+        const int64_t latency = now() - e.push_ts;
+        m_popped.fetch_add(1u, std::memory_order_relaxed);
+        m_latency_sum.fetch_add(latency, std::memory_order_relaxed);
+        update_max(m_max_latency, latency);
+    }
+
+public:
+    LockFreeQueue(std::size_t capacity, std::size_t spin_count, bool collect_stats)
+        : m_ring(capacity), m_collect_stats(collect_stats) {
+        m_ring.set_spin_count(spin_count);
+    }
+
+    virtual void push(const Cmd &cmd) override {
+        Entry e;
+        e.cmd = cmd;
+        on_push(e);
+        m_ring.push(e);
+        notify();
+    }
+    virtual void pop(Cmd &cmd) override {
+        Entry e;
+        m_ring.pop(e);
+        on_pop(e);
+        cmd = std::move(e.cmd);
+        notify();
+    }
+    virtual bool try_pop(Cmd &cmd) override {
+        Entry e;
+        if (!m_ring.try_pop(e)) {
+            return false;
+        }
+        on_pop(e);
+        cmd = std::move(e.cmd);
+        notify();
+        return true;
+    }
+    virtual void clear() override {
+        m_ring.clear();
+        m_pushed = 0u;
+        m_occupancy_sum = 0u;
+        m_max_occupancy = 0u;
+        m_popped = 0u;
+        m_latency_sum = 0;
+        m_max_latency = 0;
+    }
+    virtual bool empty() override { return m_ring.size() == 0u; }
+    virtual bool full()  override { return m_ring.size() >= m_ring.capacity(); }
+
+    virtual cv::util::optional<QueueStats> stats() override {
+        if (!m_collect_stats) {
+            return {};
+        }
+        QueueStats s;
+        s.pushed        = m_pushed.load();
+        s.max_occupancy = m_max_occupancy.load();
+        s.avg_occupancy = s.pushed != 0u
+            ? static_cast<double>(m_occupancy_sum.load()) / s.pushed : 0.;
+        const std::size_t popped = m_popped.load();
+        s.avg_latency_us = popped != 0u
+            ? static_cast<double>(m_latency_sum.load()) / popped * 1e-3 : 0.;
+        s.max_latency_us = static_cast<double>(m_max_latency.load()) * 1e-3;
+        return cv::util::make_optional(s);
+    }
+};
+
+// Single producer: island-to-island queues
+using SpscQueue = LockFreeQueue<cv::gapi::own::spsc_bounded_queue>;
+// Multiple producers: the final queue if there are multiple collectors
+using MpscQueue = LockFreeQueue<cv::gapi::own::mpsc_bounded_queue>;
+
 } // namespace stream
 
 // FIXME: Currently all GExecutor comments apply also
@@ -162,6 +322,11 @@ protected:
     class Synchronizer;
     std::unique_ptr<Synchronizer> m_sync;
 
+    // Runs the actors on a shared work-stealing pool instead of
+    // the dedicated threads (see cv::gapi::streaming::shared_pool)
+    class ActorScheduler;
+    std::unique_ptr<ActorScheduler> m_scheduler;
+
     std::vector<std::thread> m_threads;
     std::vector<stream::SyncQueue>   m_emitter_queues;
 
@@ -175,7 +340,7 @@ protected:
     std::vector<int>                 m_sink_sync;
 
     std::unordered_set<stream::Q*>   m_internal_queues;
-    stream::SyncQueue m_out_queue;
+    std::unique_ptr<stream::Q>       m_out_queue;
 
     // Describes mapping from desync paths to collector threads
     struct CollectorThreadInfo {
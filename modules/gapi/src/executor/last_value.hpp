@@ -49,6 +49,7 @@ public:
     void push(const T &t);
     void pop(T &t);
     bool try_pop(T &t);
+    bool empty();
 
     // Not thread-safe
     void clear();
@@ -94,6 +95,13 @@ bool last_written_value<T>::try_pop(T &t) {
     return true;
 }
 
+// Check if there is a value written since the last read
+template<typename T>
+bool last_written_value<T>::empty() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return !m_data.has_value();
+}
+
 // Clear the value holder. This method is not thread-safe.
 template<typename T>
 void last_written_value<T>::clear() {
@@ -0,0 +1,299 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+//
+// Copyright (C) 2024 Intel Corporation
+
+#ifndef OPENCV_GAPI_EXECUTOR_LOCK_FREE_QUEUE_HPP
+#define OPENCV_GAPI_EXECUTOR_LOCK_FREE_QUEUE_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include <opencv2/gapi/own/assert.hpp>
+
+namespace cv {
+namespace gapi {
+namespace own {
+
+namespace detail {
+
+// Keeps producer's and consumer's indices on different cache lines
+constexpr std::size_t CACHE_LINE_SIZE = 64u;
+
+// Waiting strategy for the lock-free queues: check the condition in
+// a loop for a while (yielding the CPU after the first iterations),
+// then park the thread on a condition variable.
+// The notifying side touches the mutex only if somebody is parked.
+class spin_park_waiter {
+    std::size_t m_spin_count = 1024u;
+    std::atomic<int> m_parked{0};
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+
+public:
+    void set_spin_count(std::size_t spin_count) { m_spin_count = spin_count; }
+
+    template<typename Pred>
+    void wait(Pred pred) {
+        constexpr std::size_t kBusyIters = 64u;
+        for (std::size_t i = 0u; i < m_spin_count; ++i) {
+            if (pred()) {
+                return;
+            }
+            if (i >= kBusyIters) {
+                std::this_thread::yield();
+            }
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_parked.fetch_add(1);
+        // NB: Pairs with the fence in notify(): either the condition is
+        // seen satisfied here or the parked thread is seen there.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cond.wait(lock, pred);
+        m_parked.fetch_sub(1);
+    }
+
+    void notify() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_parked.load(std::memory_order_relaxed) != 0) {
+            { std::lock_guard<std::mutex> lock(m_mutex); }
+            m_cond.notify_all();
+        }
+    }
+};
+
+} // namespace detail
+
+// Bounded single-producer single-consumer ring buffer.
+//
+// push() and pop() never take a lock unless the queue is full or
+// empty for longer than the spinning phase lasts.
+// Only one thread at a time may push and only one may pop, but these
+// may be different threads over time as long as the calls are
+// externally ordered (e.g. done under a mutex).
+template<typename T>
+class spsc_bounded_queue {
+    std::unique_ptr<T[]> m_data;
+    std::size_t m_capacity;
+
+    char m_pad0[detail::CACHE_LINE_SIZE];
+    std::atomic<std::size_t> m_head{0u}; // Next element to pop, written by consumer
+    char m_pad1[detail::CACHE_LINE_SIZE];
+    std::atomic<std::size_t> m_tail{0u}; // Next slot to push, written by producer
+    char m_pad2[detail::CACHE_LINE_SIZE];
+
+    detail::spin_park_waiter m_not_empty;
+    detail::spin_park_waiter m_not_full;
+
+public:
+    explicit spsc_bounded_queue(std::size_t capacity)
+        : m_data(new T[capacity]), m_capacity(capacity) {
+        GAPI_Assert(capacity != 0u);
+    }
+
+    bool try_push(const T &t);
+    void push(const T &t);
+    bool try_pop(T &t);
+    void pop(T &t);
+
+    void set_spin_count(std::size_t spin_count) {
+        m_not_empty.set_spin_count(spin_count);
+        m_not_full.set_spin_count(spin_count);
+    }
+    std::size_t capacity() const { return m_capacity; }
+
+    // Number of elements at the moment of the call
+    std::size_t size() const {
+        // NB: Head goes first, so it can't be ahead of the tail
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    // Not thread-safe
+    void clear();
+};
+
+template<typename T>
+bool spsc_bounded_queue<T>::try_push(const T &t) {
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == m_capacity) {
+        return false;
+    }
+    m_data[tail % m_capacity] = t;
+    m_tail.store(tail + 1u, std::memory_order_release);
+    m_not_empty.notify();
+    return true;
+}
+
+template<typename T>
+void spsc_bounded_queue<T>::push(const T &t) {
+    while (!try_push(t)) {
+        m_not_full.wait([this](){ return size() < m_capacity; });
+    }
+}
+
+template<typename T>
+bool spsc_bounded_queue<T>::try_pop(T &t) {
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    T &slot = m_data[head % m_capacity];
+    t = std::move(slot);
+    // NB: Release the resources (e.g. the frame data) held by the slot
+    slot = T{};
+    m_head.store(head + 1u, std::memory_order_release);
+    m_not_full.notify();
+    return true;
+}
+
+template<typename T>
+void spsc_bounded_queue<T>::pop(T &t) {
+    while (!try_pop(t)) {
+        m_not_empty.wait([this](){ return size() != 0u; });
+    }
+}
+
+template<typename T>
+void spsc_bounded_queue<T>::clear() {
+    for (std::size_t i = 0u; i < m_capacity; ++i) {
+        m_data[i] = T{};
+    }
+    m_head = 0u;
+    m_tail = 0u;
+}
+
+// Bounded multi-producer single-consumer ring buffer.
+//
+// Every slot carries a sequence number which tells whether the slot is
+// free for the push at the given position or holds the element for the
+// pop at the given position, so producers only compete on the tail
+// index (D. Vyukov's bounded queue, with a single consumer).
+template<typename T>
+class mpsc_bounded_queue {
+    struct Cell {
+        std::atomic<std::size_t> seq;
+        T data;
+    };
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_capacity;
+
+    char m_pad0[detail::CACHE_LINE_SIZE];
+    std::atomic<std::size_t> m_head{0u};
+    char m_pad1[detail::CACHE_LINE_SIZE];
+    std::atomic<std::size_t> m_tail{0u};
+    char m_pad2[detail::CACHE_LINE_SIZE];
+
+    detail::spin_park_waiter m_not_empty;
+    detail::spin_park_waiter m_not_full;
+
+    bool can_pop() const {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        return m_cells[head % m_capacity].seq.load(std::memory_order_acquire) == head + 1u;
+    }
+
+public:
+    explicit mpsc_bounded_queue(std::size_t capacity)
+        : m_cells(new Cell[capacity]), m_capacity(capacity) {
+        // NB: With a single cell "free for the next push" and "holds
+        // the previous element" states of a cell are indistinguishable
+        GAPI_Assert(capacity >= 2u);
+        for (std::size_t i = 0u; i < capacity; ++i) {
+            m_cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool try_push(const T &t);
+    void push(const T &t);
+    bool try_pop(T &t);
+    void pop(T &t);
+
+    void set_spin_count(std::size_t spin_count) {
+        m_not_empty.set_spin_count(spin_count);
+        m_not_full.set_spin_count(spin_count);
+    }
+    std::size_t capacity() const { return m_capacity; }
+
+    // Number of elements at the moment of the call, including
+    // the ones which are being pushed right now
+    std::size_t size() const {
+        const std::size_t head = m_head.load(std::memory_order_acquire);
+        const std::size_t tail = m_tail.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0u;
+    }
+
+    // Not thread-safe
+    void clear();
+};
+
+template<typename T>
+bool mpsc_bounded_queue<T>::try_push(const T &t) {
+    std::size_t pos = m_tail.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    while (true) {
+        cell = &m_cells[pos % m_capacity];
+        const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+        const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (m_tail.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // The slot is not popped yet - the queue is full
+        } else {
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+    cell->data = t;
+    cell->seq.store(pos + 1u, std::memory_order_release);
+    m_not_empty.notify();
+    return true;
+}
+
+template<typename T>
+void mpsc_bounded_queue<T>::push(const T &t) {
+    while (!try_push(t)) {
+        m_not_full.wait([this](){ return size() < m_capacity; });
+    }
+}
+
+template<typename T>
+bool mpsc_bounded_queue<T>::try_pop(T &t) {
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    Cell &cell = m_cells[head % m_capacity];
+    if (cell.seq.load(std::memory_order_acquire) != head + 1u) {
+        return false;
+    }
+    t = std::move(cell.data);
+    cell.data = T{};
+    cell.seq.store(head + m_capacity, std::memory_order_release);
+    m_head.store(head + 1u, std::memory_order_release);
+    m_not_full.notify();
+    return true;
+}
+
+template<typename T>
+void mpsc_bounded_queue<T>::pop(T &t) {
+    while (!try_pop(t)) {
+        m_not_empty.wait([this](){ return can_pop(); });
+    }
+}
+
+template<typename T>
+void mpsc_bounded_queue<T>::clear() {
+    for (std::size_t i = 0u; i < m_capacity; ++i) {
+        m_cells[i].seq.store(i, std::memory_order_relaxed);
+        m_cells[i].data = T{};
+    }
+    m_head = 0u;
+    m_tail = 0u;
+}
+
+}}} // namespace cv::gapi::own
+
+#endif // OPENCV_GAPI_EXECUTOR_LOCK_FREE_QUEUE_HPP
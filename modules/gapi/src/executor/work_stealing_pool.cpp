@@ -0,0 +1,138 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+//
+// Copyright (C) 2024 Intel Corporation
+
+
+#include "work_stealing_pool.hpp"
+
+#include <algorithm> // max
+
+#include <opencv2/gapi/own/assert.hpp>
+
+namespace {
+// Identifies the pool and the deque of the current worker thread
+thread_local cv::gapi::own::WorkStealingPool* tl_pool = nullptr;
+thread_local std::size_t tl_worker_idx = 0u;
+} // anonymous namespace
+
+cv::gapi::own::WorkStealingPool::WorkStealingPool(const uint32_t num_workers) {
+    GAPI_Assert(num_workers > 0u);
+    m_queues.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; ++i) {
+        m_queues.emplace_back(new WorkerQueue{});
+    }
+    m_workers.reserve(num_workers);
+    for (uint32_t i = 0; i < num_workers; ++i) {
+        m_workers.emplace_back(&cv::gapi::own::WorkStealingPool::worker, this, i);
+    }
+}
+
+uint32_t cv::gapi::own::WorkStealingPool::size() const {
+    return static_cast<uint32_t>(m_workers.size());
+}
+
+void cv::gapi::own::WorkStealingPool::schedule(cv::gapi::own::WorkStealingPool::Task&& task) {
+    const std::size_t idx = tl_pool == this
+        ? tl_worker_idx
+        : m_next.fetch_add(1u) % m_queues.size();
+    {
+        std::lock_guard<std::mutex> lk{m_queues[idx]->mutex};
+        m_queues[idx]->tasks.push_back(std::move(task));
+    }
+    m_pending.fetch_add(1u);
+    {
+        // NB: Take the lock so the notification can't be lost between
+        // the worker's check of m_pending and its wait on the condition.
+        std::lock_guard<std::mutex> lk{m_park_mutex};
+    }
+    m_park_cv.notify_one();
+}
+
+bool cv::gapi::own::WorkStealingPool::tryPop(const std::size_t idx,
+                                              cv::gapi::own::WorkStealingPool::Task& task) {
+    // Own deque first, from the back
+    {
+        auto& q = *m_queues[idx];
+        std::lock_guard<std::mutex> lk{q.mutex};
+        if (!q.tasks.empty()) {
+            task = std::move(q.tasks.back());
+            q.tasks.pop_back();
+            m_pending.fetch_sub(1u);
+            return true;
+        }
+    }
+    // Then steal from the others, from the front
+    for (std::size_t i = 1u; i < m_queues.size(); ++i) {
+        auto& q = *m_queues[(idx + i) % m_queues.size()];
+        std::lock_guard<std::mutex> lk{q.mutex};
+        if (!q.tasks.empty()) {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            m_pending.fetch_sub(1u);
+            return true;
+        }
+    }
+    return false;
+}
+
+void cv::gapi::own::WorkStealingPool::worker(const std::size_t idx) {
+    tl_pool = this;
+    tl_worker_idx = idx;
+    while (true) {
+        Task task;
+        if (tryPop(idx, task)) {
+            task();
+            continue;
+        }
+        std::unique_lock<std::mutex> lk{m_park_mutex};
+        m_park_cv.wait(lk, [this](){ return m_stop || m_pending.load() > 0u; });
+        if (m_stop && m_pending.load() == 0u) {
+            break;
+        }
+    }
+    tl_pool = nullptr;
+}
+
+bool cv::gapi::own::WorkStealingPool::runPendingTask() {
+    if (tl_pool == nullptr) {
+        return false;
+    }
+    Task task;
+    if (!tl_pool->tryPop(tl_worker_idx, task)) {
+        return false;
+    }
+    task();
+    return true;
+}
+
+void cv::gapi::own::WorkStealingPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lk{m_park_mutex};
+        m_stop = true;
+    }
+    m_park_cv.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+}
+
+cv::gapi::own::WorkStealingPool::~WorkStealingPool() {
+    shutdown();
+}
+
+cv::gapi::own::WorkStealingPool&
+cv::gapi::own::WorkStealingPool::shared(const uint32_t num_workers) {
+    static std::mutex mutex;
+    static std::unique_ptr<WorkStealingPool> pool;
+    std::lock_guard<std::mutex> lk{mutex};
+    if (!pool) {
+        const uint32_t n = num_workers != 0u
+            ? num_workers
+            : std::max(1u, std::thread::hardware_concurrency());
+        pool.reset(new WorkStealingPool(n));
+    }
+    return *pool;
+}
@@ -0,0 +1,76 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+//
+// Copyright (C) 2024 Intel Corporation
+
+#ifndef OPENCV_GAPI_WORK_STEALING_POOL_HPP
+#define OPENCV_GAPI_WORK_STEALING_POOL_HPP
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+#include <opencv2/gapi/own/exports.hpp> // GAPI_EXPORTS
+
+namespace cv {
+namespace gapi {
+namespace own {
+
+// A thread pool where every worker owns a task deque.
+// Tasks scheduled from a worker thread go to the back of its own deque
+// and are popped from there (LIFO, so the data just produced is likely
+// still in cache). Idle workers steal from the front of other workers'
+// deques. Tasks scheduled from outside of the pool are distributed
+// round-robin.
+class GAPI_EXPORTS WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+    explicit WorkStealingPool(const uint32_t num_workers);
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    void schedule(Task&& task);
+    uint32_t size() const;
+    ~WorkStealingPool();
+
+    // Executes one pending task of the pool the calling thread belongs to.
+    // Returns false if the calling thread is not a pool worker or
+    // there is nothing to execute.
+    // Used by tasks which have to wait for other tasks to make progress.
+    static bool runPendingTask();
+
+    // Process-wide pool shared by all its users.
+    // The pool is created by the first call, num_workers == 0 means
+    // the number of hardware threads. Later calls return the same pool.
+    static WorkStealingPool& shared(const uint32_t num_workers);
+
+private:
+    struct WorkerQueue {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    void worker(const std::size_t idx);
+    bool tryPop(const std::size_t idx, Task& task);
+    void shutdown();
+
+private:
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::thread>                  m_workers;
+    std::atomic<std::size_t>                  m_pending{0u};
+    std::atomic<std::size_t>                  m_next{0u};
+    std::mutex                                m_park_mutex;
+    std::condition_variable                   m_park_cv;
+    bool                                      m_stop = false;
+};
+
+}}} // namespace cv::gapi::own
+
+#endif // OPENCV_GAPI_WORK_STEALING_POOL_HPP
@@ -95,6 +95,29 @@ INSTANTIATE_TEST_CASE_P(BayerGR2RGBTestFluid, BayerGR2RGBTest,
                                 Values(IMGPROC_FLUID),
                                 Values(ToleranceColor(1e-3).to_compare_obj())));
 
+INSTANTIATE_TEST_CASE_P(NV12toRGBTestFluid, NV12toRGBTest,
+                        Combine(Values(CV_8UC1),
+                                Values(cv::Size(1280, 720),
+                                       cv::Size(46, 30)),
+                                Values(CV_8UC3),
+                                Values(IMGPROC_FLUID),
+                                Values(AbsExact().to_compare_obj())));
+
+INSTANTIATE_TEST_CASE_P(NV12toBGRTestFluid, NV12toBGRTest,
+                        Combine(Values(CV_8UC1),
+                                Values(cv::Size(1280, 720),
+                                       cv::Size(46, 30)),
+                                Values(CV_8UC3),
+                                Values(IMGPROC_FLUID),
+                                Values(AbsExact().to_compare_obj())));
+
+INSTANTIATE_TEST_CASE_P(NV12toGrayTestFluid, NV12toGrayTest,
+                        Combine(Values(CV_8UC1),
+                                Values(cv::Size(1280, 720)),
+                                Values(CV_8UC1),
+                                Values(IMGPROC_FLUID),
+                                Values(AbsExact().to_compare_obj())));
+
 INSTANTIATE_TEST_CASE_P(RGB2YUV422TestFluid, RGB2YUV422Test,
                         Combine(Values(CV_8UC3),
                                 Values(cv::Size(1280, 720)),
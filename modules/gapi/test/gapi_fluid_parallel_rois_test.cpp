@@ -286,6 +286,68 @@ INSTANTIATE_TEST_CASE_P(FluidTiledParallel8x10, TiledComputation,
                             tilesets_8x10(),
                             Values(serial_for, cv_parallel_for))
 );
+
+struct AutoTiledComputation : public TestWithParam <std::tuple<ComputationPair*, cv::Size, int /*max tiles*/>> {};
+TEST_P(AutoTiledComputation, Test)
+{
+    ComputationPair* cp;
+    cv::Size         img_sz;
+    int              max_tiles = 0;
+    auto             mat_type  = CV_8UC1;
+
+    std::tie(cp, img_sz, max_tiles) = GetParam();
+
+    cv::Mat in_mat       =      randomMat(img_sz, mat_type);
+    cv::Mat out_mat_gapi = cv::Mat::zeros(img_sz, mat_type);
+    cv::Mat out_mat_ocv  = cv::Mat::zeros(img_sz, mat_type);
+
+    cv::GFluidParallelTiling tiling;
+    tiling.max_tiles     = max_tiles;
+    tiling.min_tile_rows = 4;
+
+    cp->run_with_gapi(in_mat, cv::compile_args(tiling, cv::GFluidParallelFor{cv_parallel_for}), out_mat_gapi);
+    cp->run_with_ocv (in_mat, {cv::Rect{}}, out_mat_ocv);
+
+    EXPECT_EQ(0, cvtest::norm(out_mat_gapi, out_mat_ocv, NORM_INF));
+}
+
+INSTANTIATE_TEST_CASE_P(FluidAutoTiled, AutoTiledComputation,
+                        Combine(
+                            single_arg_computations(),
+                            Values(cv::Size(8, 10), cv::Size(320, 240), cv::Size(33, 101)),
+                            Values(0, 2, 3, 7))
+);
+
+TEST(FluidAutoTiledParallelFor, NumberOfTiles)
+{
+    cv::Size img_sz{8, 100};
+    auto     mat_type = CV_8UC1;
+
+    cv::GMat in;
+    cv::GMat out = TAddCSimple::on(in, 1);
+    cv::GComputation c(cv::GIn(in), cv::GOut(out));
+
+    cv::Mat in_mat       =      randomMat(img_sz, mat_type);
+    cv::Mat out_mat_gapi = cv::Mat::zeros(img_sz, mat_type);
+
+    std::size_t items_count = 0;
+    auto pfor = [&items_count](std::size_t count, std::function<void(std::size_t)> f){
+        items_count = count;
+        serial_for(count, f);
+    };
+
+    cv::GFluidParallelTiling tiling;
+    tiling.max_tiles     = 8;
+    tiling.min_tile_rows = 20;
+
+    // 100 rows can give only 5 tiles of 20 rows
+    auto cc = c.compile(cv::descr_of(in_mat), cv::compile_args(fluidTestPackage, tiling, GFluidParallelFor{pfor}));
+    cc(cv::gin(in_mat), cv::gout(out_mat_gapi));
+    EXPECT_EQ(5u, items_count);
+
+    cv::Mat out_mat_ocv = in_mat + 1;
+    EXPECT_EQ(0, cvtest::norm(out_mat_gapi, out_mat_ocv, NORM_INF));
+}
 } // namespace opencv_test
 
 //define custom printer for "parallel_for" test parameter
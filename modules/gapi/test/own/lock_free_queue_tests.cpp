@@ -0,0 +1,176 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+//
+// Copyright (C) 2024 Intel Corporation
+
+#include "../test_precomp.hpp"
+
+#include <thread>
+
+#include "executor/lock_free_queue.hpp"
+
+namespace opencv_test
+{
+using namespace cv::gapi;
+
+TEST(SPSCQueue, PushPop)
+{
+    own::spsc_bounded_queue<int> q(100u);
+    for (int i = 0; i < 100; i++)
+    {
+        q.push(i);
+    }
+    EXPECT_EQ(100u, q.size());
+
+    for (int i = 0; i < 100; i++)
+    {
+        int x;
+        q.pop(x);
+        EXPECT_EQ(i, x);
+    }
+    EXPECT_EQ(0u, q.size());
+}
+
+TEST(SPSCQueue, TryPushTryPop)
+{
+    own::spsc_bounded_queue<int> q(2u);
+    int x = 0;
+    EXPECT_FALSE(q.try_pop(x));
+
+    EXPECT_TRUE(q.try_push(1));
+    EXPECT_TRUE(q.try_push(2));
+    EXPECT_FALSE(q.try_push(3));
+
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(1, x);
+    EXPECT_TRUE(q.try_push(3));
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(2, x);
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(3, x);
+    EXPECT_FALSE(q.try_pop(x));
+}
+
+TEST(SPSCQueue, Clear)
+{
+    own::spsc_bounded_queue<int> q(10u);
+    for (int i = 0; i < 10; i++)
+    {
+        q.push(i);
+    }
+
+    q.clear();
+    int x = 0;
+    EXPECT_FALSE(q.try_pop(x));
+    EXPECT_EQ(0u, q.size());
+}
+
+TEST(MPSCQueue, TryPushTryPop)
+{
+    own::mpsc_bounded_queue<int> q(2u);
+    int x = 0;
+    EXPECT_FALSE(q.try_pop(x));
+
+    EXPECT_TRUE(q.try_push(1));
+    EXPECT_TRUE(q.try_push(2));
+    EXPECT_FALSE(q.try_push(3));
+    EXPECT_EQ(2u, q.size());
+
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(1, x);
+    EXPECT_TRUE(q.try_push(3));
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(2, x);
+    EXPECT_TRUE(q.try_pop(x));
+    EXPECT_EQ(3, x);
+    EXPECT_FALSE(q.try_pop(x));
+}
+
+namespace
+{
+using LockFreeStressParam = std::tuple<int           // Num writer threads
+                                      ,int           // Num elements per writer
+                                      ,std::size_t   // Queue capacity
+                                      ,std::size_t>; // Spin count
+constexpr int LF_BASE = 100000;
+}
+
+struct MPSCQueue_: public ::testing::TestWithParam<LockFreeStressParam> {};
+
+// Every writer produces its own increasing range of numbers, the only
+// reader must get all of them and in order within every range.
+TEST_P(MPSCQueue_, Test)
+{
+    int num_writers = 0;
+    int num_writes  = 0;
+    std::size_t capacity = 0u, spins = 0u;
+    std::tie(num_writers, num_writes, capacity, spins) = GetParam();
+
+    own::mpsc_bounded_queue<int> q(capacity);
+    q.set_spin_count(spins);
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < num_writers; w++)
+    {
+        writers.emplace_back([&q, w, num_writes]() {
+            for (int i = 0; i < num_writes; i++) q.push(w*LF_BASE + i);
+        });
+    }
+
+    std::vector<int> next(num_writers, 0);
+    for (int i = 0; i < num_writers * num_writes; i++)
+    {
+        int x = 0;
+        q.pop(x);
+        const int w = x / LF_BASE;
+        ASSERT_EQ(next[w], x % LF_BASE);
+        next[w]++;
+    }
+    for (auto &t : writers) t.join();
+
+    int x = 0;
+    EXPECT_FALSE(q.try_pop(x));
+    for (int w = 0; w < num_writers; w++)
+    {
+        EXPECT_EQ(num_writes, next[w]);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(MPSCQueueStress, MPSCQueue_,
+                        Combine(  Values(1, 2, 4, 8)         // writers
+                                , Values(1, 100, 10000)      // writes
+                                , Values(2u, 4u, 32u)        // capacity
+                                , Values(0u, 1024u)));       // spins
+
+// The SPSC queue is passed between the threads in a ping-pong way,
+// so both spinning and parking paths are exercised.
+TEST(SPSCQueue, PingPong)
+{
+    const int kNumIters = 10000;
+    own::spsc_bounded_queue<int> ping(1u), pong(1u);
+    ping.set_spin_count(16u);
+    pong.set_spin_count(16u);
+
+    std::thread echo([&]() {
+        int x = 0;
+        do {
+            ping.pop(x);
+            pong.push(x);
+        } while (x != -1);
+    });
+
+    for (int i = 0; i < kNumIters; i++)
+    {
+        int x = 0;
+        ping.push(i);
+        pong.pop(x);
+        ASSERT_EQ(i, x);
+    }
+    int x = 0;
+    ping.push(-1);
+    pong.pop(x);
+    echo.join();
+    EXPECT_EQ(-1, x);
+}
+} // namespace opencv_test
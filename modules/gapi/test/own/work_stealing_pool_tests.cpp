@@ -0,0 +1,115 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+//
+// Copyright (C) 2024 Intel Corporation
+
+#include "../test_precomp.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include "executor/thread_pool.hpp" // Latch
+#include "executor/work_stealing_pool.hpp"
+
+namespace opencv_test
+{
+
+using namespace cv::gapi;
+
+TEST(WorkStealingPool, ScheduleNotBlock)
+{
+    own::Latch latch(1u);
+    std::atomic<uint32_t> counter{0u};
+
+    own::WorkStealingPool pool(4u);
+    pool.schedule([&](){
+        std::this_thread::sleep_for(std::chrono::milliseconds{500u});
+        counter++;
+        latch.count_down();
+    });
+
+    EXPECT_EQ(0u, counter);
+    latch.wait();
+    EXPECT_EQ(1u, counter);
+}
+
+TEST(WorkStealingPool, MultipleTasks)
+{
+    const uint32_t kNumTasks = 100u;
+    own::Latch latch(kNumTasks);
+    std::atomic<uint32_t> completed{0u};
+
+    own::WorkStealingPool pool(4u);
+    for (uint32_t i = 0; i < kNumTasks; ++i) {
+        pool.schedule([&]() {
+            ++completed;
+            latch.count_down();
+        });
+    }
+    latch.wait();
+
+    EXPECT_EQ(kNumTasks, completed.load());
+}
+
+TEST(WorkStealingPool, TasksAreStolen)
+{
+    const uint32_t kNumThreads = 4u;
+    own::Latch latch(kNumThreads);
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+
+    own::WorkStealingPool pool(kNumThreads);
+    // NB: All the tasks are scheduled from the same worker, so they go
+    // to its own deque. They can only complete if the other workers steal them.
+    pool.schedule([&]() {
+        for (uint32_t i = 0; i < kNumThreads; ++i) {
+            pool.schedule([&]() {
+                {
+                    std::lock_guard<std::mutex> lk{mutex};
+                    ids.insert(std::this_thread::get_id());
+                }
+                latch.count_down();
+                // Keep the worker busy until all the tasks are taken
+                latch.wait();
+            });
+        }
+    });
+    latch.wait();
+
+    EXPECT_EQ(kNumThreads, ids.size());
+}
+
+TEST(WorkStealingPool, RunPendingTask)
+{
+    // NB: Not a worker thread
+    EXPECT_FALSE(own::WorkStealingPool::runPendingTask());
+
+    own::Latch latch(1u);
+    std::atomic<bool> executed{false};
+
+    own::WorkStealingPool pool(1u);
+    pool.schedule([&]() {
+        // The only worker waits for the task scheduled after it
+        // and executes this task itself.
+        pool.schedule([&]() { executed = true; });
+        while (!executed) {
+            own::WorkStealingPool::runPendingTask();
+        }
+        latch.count_down();
+    });
+    latch.wait();
+
+    EXPECT_TRUE(executed.load());
+}
+
+TEST(WorkStealingPool, SharedIsTheSame)
+{
+    auto &pool1 = own::WorkStealingPool::shared(2u);
+    auto &pool2 = own::WorkStealingPool::shared(0u);
+
+    EXPECT_EQ(&pool1, &pool2);
+    EXPECT_LE(1u, pool1.size());
+}
+
+} // namespace opencv_test
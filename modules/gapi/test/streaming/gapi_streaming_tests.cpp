@@ -2683,4 +2683,98 @@ TEST(GAPI_Streaming_Exception, SourceThrowEverySecondFrame) {
     EXPECT_EQ(num_frames, curr_frame - 1);
 }
 
+TEST(GAPI_Streaming_SharedPool, TwoPipelines) {
+    // NB: Never throws, just produces the frames
+    constexpr size_t num_frames = 50u;
+    constexpr size_t no_throw = num_frames + 1u;
+
+    cv::GMat in;
+    cv::GMat out = cv::gapi::copy(cv::gapi::add(in, in));
+    auto args = cv::compile_args(cv::gapi::streaming::shared_pool{2u});
+    auto pipeline1 = cv::GComputation(in, out).compileStreaming(cv::GCompileArgs(args));
+    auto pipeline2 = cv::GComputation(in, out).compileStreaming(cv::GCompileArgs(args));
+
+    pipeline1.setSource(std::make_shared<InvalidSource>(no_throw, num_frames));
+    pipeline2.setSource(std::make_shared<InvalidSource>(no_throw, num_frames));
+    pipeline1.start();
+    pipeline2.start();
+
+    size_t frames1 = 0u, frames2 = 0u;
+    bool running1 = true, running2 = true;
+    cv::Mat out_mat1, out_mat2;
+    while (running1 || running2) {
+        if (running1 && (running1 = pipeline1.pull(cv::gout(out_mat1)))) {
+            ++frames1;
+        }
+        if (running2 && (running2 = pipeline2.pull(cv::gout(out_mat2)))) {
+            ++frames2;
+        }
+    }
+
+    EXPECT_EQ(num_frames, frames1);
+    EXPECT_EQ(num_frames, frames2);
+}
+
+TEST(GAPI_Streaming_LockFreeQueues, SmokeTest) {
+    constexpr size_t num_frames = 100u;
+    constexpr size_t no_throw = num_frames + 1u;
+
+    cv::GMat in;
+    cv::GMat out = cv::gapi::copy(cv::gapi::add(in, in));
+    auto pipeline = cv::GComputation(in, out)
+        .compileStreaming(cv::compile_args(cv::gapi::streaming::lock_free_queues{16u, true}));
+
+    pipeline.setSource(std::make_shared<InvalidSource>(no_throw, num_frames));
+    pipeline.start();
+
+    size_t frames = 0u;
+    cv::Mat out_mat;
+    while (pipeline.pull(cv::gout(out_mat))) {
+        ++frames;
+    }
+    EXPECT_EQ(num_frames, frames);
+}
+
+TEST(GAPI_Streaming_LockFreeQueues, Desync) {
+    cv::GMat in;
+    cv::GMat tmp = cv::gapi::boxFilter(in, -1, cv::Size(3,3));
+    cv::GMat out1 = cv::gapi::Canny(tmp, 32, 128, 3);
+    // Desynchronized part has its own collector, so the final
+    // queue gets multiple producers
+    cv::GMat tmp2 = cv::gapi::streaming::desync(tmp);
+    cv::GMat out2 = cv::gapi::Sobel(tmp2, CV_8U, 1, 1);
+
+    auto pipeline = cv::GComputation(cv::GIn(in), cv::GOut(out1, out2))
+        .compileStreaming(cv::compile_args(cv::gapi::streaming::lock_free_queues{}));
+
+    constexpr size_t num_frames = 50u;
+    pipeline.setSource(std::make_shared<InvalidSource>(num_frames + 1u, num_frames));
+    pipeline.start();
+
+    cv::optional<cv::Mat> out_mat1, out_mat2;
+    size_t frames1 = 0u;
+    while (pipeline.pull(cv::gout(out_mat1, out_mat2))) {
+        if (out_mat1) ++frames1;
+    }
+    EXPECT_EQ(num_frames, frames1);
+}
+
+TEST(GAPI_Streaming_SharedPool, StopStart) {
+    constexpr size_t num_frames = 1000u;
+    constexpr size_t no_throw = num_frames + 1u;
+
+    cv::GMat in;
+    auto pipeline = cv::GComputation(in, cv::gapi::copy(in))
+        .compileStreaming(cv::compile_args(cv::gapi::streaming::shared_pool{2u}));
+
+    for (int i = 0; i < 10; ++i) {
+        pipeline.setSource(std::make_shared<InvalidSource>(no_throw, num_frames));
+        pipeline.start();
+        cv::Mat out_mat;
+        EXPECT_TRUE(pipeline.pull(cv::gout(out_mat)));
+        pipeline.stop();
+        EXPECT_FALSE(pipeline.running());
+    }
+}
+
 } // namespace opencv_test
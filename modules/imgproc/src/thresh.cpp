@@ -1731,13 +1731,33 @@ void cv::adaptiveThreshold( InputArray _src, OutputArray _dst, double maxValue,
         size.height = 1;
     }
 
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    // Same as tab[]: the difference sdata - mdata (-255..255) is compared with -idelta
+    const v_int16 v_thresh = vx_setall_s16((short)std::min(std::max(-idelta, -256), 256));
+    const v_uint8 v_inv = vx_setall_u8(type == cv::THRESH_BINARY_INV ? 255 : 0);
+    const v_uint8 v_maxval = vx_setall_u8(imaxval);
+#endif
+
     for( i = 0; i < size.height; i++ )
     {
         const uchar* sdata = src.ptr(i);
         const uchar* mdata = mean.ptr(i);
         uchar* ddata = dst.ptr(i);
 
-        for( j = 0; j < size.width; j++ )
+        j = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+        for( ; j <= size.width - VTraits<v_uint8>::vlanes(); j += VTraits<v_uint8>::vlanes() )
+        {
+            v_uint16 s0, s1, m0, m1;
+            v_expand(vx_load(sdata + j), s0, s1);
+            v_expand(vx_load(mdata + j), m0, m1);
+            v_int16 d0 = v_sub(v_reinterpret_as_s16(s0), v_reinterpret_as_s16(m0));
+            v_int16 d1 = v_sub(v_reinterpret_as_s16(s1), v_reinterpret_as_s16(m1));
+            v_uint8 mask = v_reinterpret_as_u8(v_pack(v_gt(d0, v_thresh), v_gt(d1, v_thresh)));
+            v_store(ddata + j, v_and(v_xor(mask, v_inv), v_maxval));
+        }
+#endif
+        for( ; j < size.width; j++ )
             ddata[j] = tab[sdata[j] - mdata[j] + 255];
     }
 }
@@ -595,4 +595,37 @@ TEST(Imgproc_AdaptiveThreshold, gauss_inv)
     EXPECT_EQ(0, cv::norm(result, gt, NORM_INF));
 }
 
+TEST(Imgproc_AdaptiveThreshold, reference)
+{
+    RNG& rng = theRNG();
+    Mat big(133, 251, CV_8UC1);
+    rng.fill(big, RNG::UNIFORM, 0, 256);
+    Mat input = big(Rect(3, 2, 237, 129));  // odd width, not continuous
+    const double deltas[] = { -300, -5, 0, 2.5, 8, 300 };
+    const int types[] = { THRESH_BINARY, THRESH_BINARY_INV };
+    for (double delta : deltas)
+    {
+        for (int type : types)
+        {
+            Mat result;
+            cv::adaptiveThreshold(input, result, 200, ADAPTIVE_THRESH_MEAN_C, type, 5, delta);
+
+            Mat mean;
+            boxFilter(input, mean, CV_8U, Size(5, 5), Point(-1, -1), true, BORDER_REPLICATE|BORDER_ISOLATED);
+            const int idelta = type == THRESH_BINARY ? cvCeil(delta) : cvFloor(delta);
+            Mat gt(input.size(), CV_8UC1);
+            for (int y = 0; y < input.rows; y++)
+            {
+                for (int x = 0; x < input.cols; x++)
+                {
+                    const int diff = input.at<uchar>(y, x) - mean.at<uchar>(y, x);
+                    const bool above = diff > -idelta;
+                    gt.at<uchar>(y, x) = (type == THRESH_BINARY ? above : !above) ? 200 : 0;
+                }
+            }
+            EXPECT_EQ(0, cv::norm(result, gt, NORM_INF)) << "delta=" << delta << " type=" << type;
+        }
+    }
+}
+
 }} // namespace
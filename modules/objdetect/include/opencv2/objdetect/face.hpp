@@ -71,6 +71,18 @@ public:
      */
     CV_WRAP virtual int detect(InputArray image, OutputArray faces) = 0;
 
+    /** @brief Detects faces in a batch of images with a single forward pass of the network.
+     *
+     * Every image is downscaled to fit the input size (see setInputSize) keeping its aspect ratio,
+     * placed at the top left corner and padded, then all images go through the network at once.
+     * Images smaller than the input size are not upscaled. The model must support a dynamic batch size.
+     *
+     *  @param images images to detect, all of the same type as accepted by detect
+     *  @param faces detection results for every image, in the same format as the output of detect,
+     *  in the coordinates of the corresponding original image
+     */
+    CV_WRAP virtual int detectBatch(InputArrayOfArrays images, OutputArrayOfArrays faces);
+
     /** @brief Creates an instance of face detector class with given parameters
      *
      *  @param model the path to the requested model
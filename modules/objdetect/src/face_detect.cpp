@@ -6,6 +6,7 @@
 
 #include "opencv2/imgproc.hpp"
 #include "opencv2/core.hpp"
+#include "opencv2/core/hal/intrin.hpp"
 
 #ifdef HAVE_OPENCV_DNN
 #include "opencv2/dnn.hpp"
@@ -17,6 +18,28 @@ namespace cv
 {
 
 #ifdef HAVE_OPENCV_DNN
+// score = sqrt(clamp(cls, 0, 1) * clamp(obj, 0, 1)) for every anchor
+static void computeScores(const float* cls_v, const float* obj_v, float* scores, int n)
+{
+    int i = 0;
+#if (CV_SIMD || CV_SIMD_SCALABLE)
+    const int vlanes = VTraits<v_float32>::vlanes();
+    const v_float32 v_zero = vx_setzero_f32(), v_one = vx_setall_f32(1.f);
+    for (; i <= n - vlanes; i += vlanes)
+    {
+        v_float32 cls_score = v_max(v_min(vx_load(cls_v + i), v_one), v_zero);
+        v_float32 obj_score = v_max(v_min(vx_load(obj_v + i), v_one), v_zero);
+        v_store(scores + i, v_sqrt(v_mul(cls_score, obj_score)));
+    }
+#endif
+    for (; i < n; i++)
+    {
+        float cls_score = MAX(MIN(cls_v[i], 1.f), 0.f);
+        float obj_score = MAX(MIN(obj_v[i], 1.f), 0.f);
+        scores[i] = std::sqrt(cls_score * obj_score);
+    }
+}
+
 class FaceDetectorYNImpl : public FaceDetectorYN
 {
 public:
@@ -147,35 +170,122 @@ public:
             input_blob = dnn::blobFromImage(pad_image);
         }
         // Forward
-        std::vector<String> output_names = { "cls_8", "cls_16", "cls_32", "obj_8", "obj_16", "obj_32", "bbox_8", "bbox_16", "bbox_32", "kps_8", "kps_16", "kps_32" };
         std::vector<Mat> output_blobs;
-        net.setInput(input_blob);
-        net.forward(output_blobs, output_names);
+        forward(input_blob, output_blobs);
 
         // Post process
-        Mat results = postProcess(output_blobs);
+        Mat results = postProcess(output_blobs, 1, 0);
         results.convertTo(faces, CV_32FC1);
         return 1;
     }
+
+    int detectBatch(InputArrayOfArrays input_images, OutputArrayOfArrays faces) override
+    {
+        const int num_images = (int)input_images.total();
+        std::vector<Mat> results(num_images);
+
+        int type = -1;
+        for (int i = 0; i < num_images; i++)
+        {
+            Mat image = input_images.getMat(i);
+            if (image.empty())
+                continue;
+            if (type < 0)
+                type = image.type();
+            CV_CheckTypeEQ(image.type(), type, "All images of the batch must have the same type");
+        }
+
+        if (type >= 0)
+        {
+            // Letterbox every image into the padded input: downscale keeping the aspect ratio
+            // and pad at the bottom and right, so only the scale has to be undone afterwards
+            std::vector<Mat> pad_images(num_images);
+            std::vector<Point2f> scales(num_images, Point2f(1.f, 1.f));
+            parallel_for_(Range(0, num_images), [&](const Range& range) {
+                for (int i = range.start; i < range.end; i++)
+                {
+                    Mat image = input_images.getMat(i);
+                    if (image.empty())
+                    {
+                        pad_images[i] = Mat::zeros(padH, padW, type);
+                        continue;
+                    }
+                    Mat resized = image;
+                    float scale = std::min((float)inputW / image.cols, (float)inputH / image.rows);
+                    if (scale < 1.f)
+                    {
+                        Size size(std::min(inputW, std::max(1, cvRound(image.cols * scale))),
+                                  std::min(inputH, std::max(1, cvRound(image.rows * scale))));
+                        resize(image, resized, size, 0, 0, INTER_AREA);
+                        scales[i] = Point2f((float)size.width / image.cols, (float)size.height / image.rows);
+                    }
+                    copyMakeBorder(resized, pad_images[i], 0, padH - resized.rows, 0, padW - resized.cols, BORDER_CONSTANT, 0);
+                }
+            });
+
+            std::vector<Mat> output_blobs;
+            forward(dnn::blobFromImages(pad_images), output_blobs);
+
+            parallel_for_(Range(0, num_images), [&](const Range& range) {
+                for (int i = range.start; i < range.end; i++)
+                {
+                    if (input_images.getMat(i).empty())
+                        continue;
+                    Mat result = postProcess(output_blobs, num_images, i);
+                    // Back to the coordinates of the original image, x and y alternate in the first 14 columns
+                    const float inv_sx = 1.f / scales[i].x, inv_sy = 1.f / scales[i].y;
+                    for (int r = 0; r < result.rows; r++)
+                    {
+                        float* face = result.ptr<float>(r);
+                        for (int k = 0; k < 14; k += 2)
+                        {
+                            face[k] *= inv_sx;
+                            face[k + 1] *= inv_sy;
+                        }
+                    }
+                    results[i] = result;
+                }
+            });
+        }
+
+        faces.create(Size(num_images, 1), CV_32FC1);
+        faces.assign(results);
+        return 1;
+    }
 private:
-    Mat postProcess(const std::vector<Mat>& output_blobs)
+    void forward(const Mat& input_blob, std::vector<Mat>& output_blobs)
+    {
+        std::vector<String> output_names = { "cls_8", "cls_16", "cls_32", "obj_8", "obj_16", "obj_32", "bbox_8", "bbox_16", "bbox_32", "kps_8", "kps_16", "kps_32" };
+        net.setInput(input_blob);
+        net.forward(output_blobs, output_names);
+    }
+
+    // Decodes the faces of the image batch_idx of the batch of batch_size images
+    Mat postProcess(const std::vector<Mat>& output_blobs, int batch_size, int batch_idx)
     {
         Mat faces;
+        AutoBuffer<float> scores;
         for (size_t i = 0; i < strides.size(); ++i) {
             int cols = int(padW / strides[i]);
             int rows = int(padH / strides[i]);
+            const size_t num_cells = (size_t)rows * cols;
 
             // Extract from output_blobs
             Mat cls = output_blobs[i];
             Mat obj = output_blobs[i + strides.size() * 1];
             Mat bbox = output_blobs[i + strides.size() * 2];
             Mat kps = output_blobs[i + strides.size() * 3];
+            CV_CheckEQ(cls.total(), num_cells * batch_size, "Unexpected output shape, the model does not support batching?");
 
             // Decode from predictions
-            float* cls_v = (float*)(cls.data);
-            float* obj_v = (float*)(obj.data);
-            float* bbox_v = (float*)(bbox.data);
-            float* kps_v = (float*)(kps.data);
+            const float* cls_v = cls.ptr<float>() + num_cells * batch_idx;
+            const float* obj_v = obj.ptr<float>() + num_cells * batch_idx;
+            const float* bbox_v = bbox.ptr<float>() + num_cells * 4 * batch_idx;
+            const float* kps_v = kps.ptr<float>() + num_cells * 10 * batch_idx;
+
+            // Scores are computed for all the anchors at once, boxes are decoded for the ones above the threshold only
+            scores.allocate(num_cells);
+            computeScores(cls_v, obj_v, scores.data(), (int)num_cells);
 
             // (tl_x, tl_y, w, h, re_x, re_y, le_x, le_y, nt_x, nt_y, rcm_x, rcm_y, lcm_x, lcm_y, score)
             // 'tl': top left point of the bounding box
@@ -183,26 +293,18 @@ private:
             // 'nt':  nose tip
             // 'rcm': right corner of mouth, 'lcm': left corner of mouth
             Mat face(1, 15, CV_32FC1);
+            float* face_v = face.ptr<float>();
 
             for(int r = 0; r < rows; ++r) {
                 for(int c = 0; c < cols; ++c) {
                     size_t idx = r * cols + c;
 
-                    // Get score
-                    float cls_score = cls_v[idx];
-                    float obj_score = obj_v[idx];
-
-                    // Clamp
-                    cls_score = MIN(cls_score, 1.f);
-                    cls_score = MAX(cls_score, 0.f);
-                    obj_score = MIN(obj_score, 1.f);
-                    obj_score = MAX(obj_score, 0.f);
-                    float score = std::sqrt(cls_score * obj_score);
-                    face.at<float>(0, 14) = score;
-
                     // Checking if the score meets the threshold before adding the face
+                    float score = scores[idx];
                     if (score < scoreThreshold)
                         continue;
+                    face_v[14] = score;
+
                     // Get bounding box
                     float cx = ((c + bbox_v[idx * 4 + 0]) * strides[i]);
                     float cy = ((r + bbox_v[idx * 4 + 1]) * strides[i]);
@@ -212,15 +314,15 @@ private:
                     float x1 = cx - w / 2.f;
                     float y1 = cy - h / 2.f;
 
-                    face.at<float>(0, 0) = x1;
-                    face.at<float>(0, 1) = y1;
-                    face.at<float>(0, 2) = w;
-                    face.at<float>(0, 3) = h;
+                    face_v[0] = x1;
+                    face_v[1] = y1;
+                    face_v[2] = w;
+                    face_v[3] = h;
 
                     // Get landmarks
                     for(int n = 0; n < 5; ++n) {
-                        face.at<float>(0, 4 + 2 * n) = (kps_v[idx * 10 + 2 * n] + c) * strides[i];
-                        face.at<float>(0, 4 + 2 * n + 1) = (kps_v[idx * 10 + 2 * n + 1]+ r) * strides[i];
+                        face_v[4 + 2 * n] = (kps_v[idx * 10 + 2 * n] + c) * strides[i];
+                        face_v[4 + 2 * n + 1] = (kps_v[idx * 10 + 2 * n + 1]+ r) * strides[i];
                     }
                     faces.push_back(face);
                 }
@@ -279,6 +381,12 @@ private:
 };
 #endif
 
+int FaceDetectorYN::detectBatch(InputArrayOfArrays images, OutputArrayOfArrays faces)
+{
+    CV_UNUSED(images); CV_UNUSED(faces);
+    CV_Error(cv::Error::StsNotImplemented, "detectBatch() is not implemented by this face detector");
+}
+
 Ptr<FaceDetectorYN> FaceDetectorYN::create(const String& model,
                                            const String& config,
                                            const Size& input_size,
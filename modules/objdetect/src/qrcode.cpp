@@ -110,6 +110,8 @@ protected:
     vector<Vec3d> searchHorizontalLines();
     vector<Point2f> separateVerticalLines(const vector<Vec3d> &list_lines);
     vector<Point2f> extractVerticalLines(const vector<Vec3d> &list_lines, double eps);
+    bool searchLocalizationPoints();
+    void refineLocalizationPoints();
     void fixationPoints(vector<Point2f> &local_point);
     vector<Point2f> getQuadrilateral(vector<Point2f> angle_list);
     bool testByPassRoute(vector<Point2f> hull, int start, int finish);
@@ -125,7 +127,7 @@ void QRDetect::init(const Mat& src, double eps_vertical_, double eps_horizontal_
 {
     CV_TRACE_FUNCTION();
     CV_Assert(!src.empty());
-    barcode = src.clone();
+    barcode = src;  // never modified, no copy is needed
     const double min_side = std::min(src.size().width, src.size().height);
     if (min_side < 512.0)
     {
@@ -154,7 +156,8 @@ void QRDetect::init(const Mat& src, double eps_vertical_, double eps_horizontal_
     eps_vertical   = eps_vertical_;
     eps_horizontal = eps_horizontal_;
 
-    if (!barcode.empty())
+    // The full resolution of a shrunk image is binarized on demand in localization()
+    if (!barcode.empty() && purpose != SHRINKING)
         adaptiveThreshold(barcode, bin_barcode, 255, ADAPTIVE_THRESH_GAUSSIAN_C, THRESH_BINARY, 83, 2);
     else
         bin_barcode.release();
@@ -165,17 +168,16 @@ void QRDetect::init(const Mat& src, double eps_vertical_, double eps_horizontal_
         resized_bin_barcode.release();
 }
 
-vector<Vec3d> QRDetect::searchHorizontalLines()
+// Finds the horizontal segments with the 1:1:3:1:1 ratio of the finder pattern in the rows [y_begin, y_end)
+static void searchHorizontalLinesInRows(const Mat& bin_barcode, int y_begin, int y_end, double eps_vertical,
+                                        vector<Vec3d>& result)
 {
-    CV_TRACE_FUNCTION();
-    vector<Vec3d> result;
-    const int height_bin_barcode = bin_barcode.rows;
     const int width_bin_barcode  = bin_barcode.cols;
     const size_t test_lines_size = 5;
     double test_lines[test_lines_size];
     vector<size_t> pixels_position;
 
-    for (int y = 0; y < height_bin_barcode; y++)
+    for (int y = y_begin; y < y_end; y++)
     {
         pixels_position.clear();
         const uint8_t *bin_barcode_row = bin_barcode.ptr<uint8_t>(y);
@@ -227,18 +229,152 @@ vector<Vec3d> QRDetect::searchHorizontalLines()
             }
         }
     }
+}
+
+static vector<Vec3d> searchHorizontalLines(const Mat& bin_barcode, double eps_vertical)
+{
+    // Stripes of rows are scanned in parallel, the results are joined in the row order
+    const int stripe_height = 32;
+    const int nstripes = (bin_barcode.rows + stripe_height - 1) / stripe_height;
+    vector<vector<Vec3d> > stripe_result(nstripes);
+    parallel_for_(Range(0, nstripes), [&](const Range& range) {
+        for (int i = range.start; i < range.end; i++)
+        {
+            searchHorizontalLinesInRows(bin_barcode, i * stripe_height, std::min((i + 1) * stripe_height, bin_barcode.rows),
+                                        eps_vertical, stripe_result[i]);
+        }
+    });
+
+    vector<Vec3d> result;
+    size_t total = 0;
+    for (const vector<Vec3d>& lines : stripe_result)
+        total += lines.size();
+    result.reserve(total);
+    for (const vector<Vec3d>& lines : stripe_result)
+        result.insert(result.end(), lines.begin(), lines.end());
     return result;
 }
 
+vector<Vec3d> QRDetect::searchHorizontalLines()
+{
+    CV_TRACE_FUNCTION();
+    return cv::searchHorizontalLines(bin_barcode, eps_vertical);
+}
+
+// Checks the vertical line through the center of every horizontal segment, returns the deviation
+// of the line from the 1:1:3:1:1 ratio of the finder pattern (or the maximal double value if the line is incomplete)
+static vector<double> computeVerticalDeviations(const Mat& bin_barcode, const vector<Vec3d> &list_lines)
+{
+    vector<double> deviations(list_lines.size(), std::numeric_limits<double>::max());
+    parallel_for_(Range(0, (int)list_lines.size()), [&](const Range& range) {
+        vector<double> test_lines; test_lines.reserve(6);
+        for (int pnt = range.start; pnt < range.end; pnt++)
+        {
+            const int x = cvRound(list_lines[pnt][0] + list_lines[pnt][2] * 0.5);
+            const int y = cvRound(list_lines[pnt][1]);
+
+            // --------------- Search vertical up-lines --------------- //
+
+            test_lines.clear();
+            uint8_t future_pixel_up = 255;
+
+            int temp_length_up = 0;
+            for (int j = y; j < bin_barcode.rows - 1; j++)
+            {
+                uint8_t next_pixel = bin_barcode.ptr<uint8_t>(j + 1)[x];
+                temp_length_up++;
+                if (next_pixel == future_pixel_up)
+                {
+                    future_pixel_up = static_cast<uint8_t>(~future_pixel_up);
+                    test_lines.push_back(temp_length_up);
+                    temp_length_up = 0;
+                    if (test_lines.size() == 3)
+                        break;
+                }
+            }
+
+            // --------------- Search vertical down-lines --------------- //
+
+            int temp_length_down = 0;
+            uint8_t future_pixel_down = 255;
+            for (int j = y; j >= 1; j--)
+            {
+                uint8_t next_pixel = bin_barcode.ptr<uint8_t>(j - 1)[x];
+                temp_length_down++;
+                if (next_pixel == future_pixel_down)
+                {
+                    future_pixel_down = static_cast<uint8_t>(~future_pixel_down);
+                    test_lines.push_back(temp_length_down);
+                    temp_length_down = 0;
+                    if (test_lines.size() == 6)
+                        break;
+                }
+            }
+
+            // --------------- Compute vertical lines --------------- //
+
+            if (test_lines.size() == 6)
+            {
+                double length = 0.0, weight = 0.0;  // TODO avoid 'double' calculations
+
+                for (size_t i = 0; i < test_lines.size(); i++)
+                    length += test_lines[i];
+
+                CV_Assert(length > 0);
+                for (size_t i = 0; i < test_lines.size(); i++)
+                {
+                    if (i % 3 != 0)
+                    {
+                        weight += fabs((test_lines[i] / length) - 1.0/ 7.0);
+                    }
+                    else
+                    {
+                        weight += fabs((test_lines[i] / length) - 3.0/14.0);
+                    }
+                }
+                deviations[pnt] = weight;
+            }
+        }
+    });
+    return deviations;
+}
+
+static vector<Point2f> selectVerticalLines(const vector<Vec3d> &list_lines, const vector<double> &deviations, double eps)
+{
+    CV_Assert(list_lines.size() == deviations.size());
+    vector<Vec3d> result;
+    for (size_t pnt = 0; pnt < list_lines.size(); pnt++)
+    {
+        if (deviations[pnt] < eps)
+        {
+            result.push_back(list_lines[pnt]);
+        }
+    }
+
+    vector<Point2f> point2f_result;
+    if (result.size() > 2)
+    {
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            point2f_result.push_back(
+                  Point2f(static_cast<float>(result[i][0] + result[i][2] * 0.5),
+                          static_cast<float>(result[i][1])));
+        }
+    }
+    return point2f_result;
+}
+
 vector<Point2f> QRDetect::separateVerticalLines(const vector<Vec3d> &list_lines)
 {
     CV_TRACE_FUNCTION();
     const double min_dist_between_points = 10.0;
     const double max_ratio = 1.0;
+    // The vertical lines don't depend on epsilon, they are checked only once
+    const vector<double> deviations = computeVerticalDeviations(bin_barcode, list_lines);
     for (int coeff_epsilon_i = 1; coeff_epsilon_i < 101; ++coeff_epsilon_i)
     {
         const float coeff_epsilon = coeff_epsilon_i * 0.1f;
-        vector<Point2f> point2f_result = extractVerticalLines(list_lines, eps_horizontal * coeff_epsilon);
+        vector<Point2f> point2f_result = selectVerticalLines(list_lines, deviations, eps_horizontal * coeff_epsilon);
         if (!point2f_result.empty())
         {
             vector<Point2f> centers;
@@ -275,92 +411,7 @@ vector<Point2f> QRDetect::separateVerticalLines(const vector<Vec3d> &list_lines)
 vector<Point2f> QRDetect::extractVerticalLines(const vector<Vec3d> &list_lines, double eps)
 {
     CV_TRACE_FUNCTION();
-    vector<Vec3d> result;
-    vector<double> test_lines; test_lines.reserve(6);
-
-    for (size_t pnt = 0; pnt < list_lines.size(); pnt++)
-    {
-        const int x = cvRound(list_lines[pnt][0] + list_lines[pnt][2] * 0.5);
-        const int y = cvRound(list_lines[pnt][1]);
-
-        // --------------- Search vertical up-lines --------------- //
-
-        test_lines.clear();
-        uint8_t future_pixel_up = 255;
-
-        int temp_length_up = 0;
-        for (int j = y; j < bin_barcode.rows - 1; j++)
-        {
-            uint8_t next_pixel = bin_barcode.ptr<uint8_t>(j + 1)[x];
-            temp_length_up++;
-            if (next_pixel == future_pixel_up)
-            {
-                future_pixel_up = static_cast<uint8_t>(~future_pixel_up);
-                test_lines.push_back(temp_length_up);
-                temp_length_up = 0;
-                if (test_lines.size() == 3)
-                    break;
-            }
-        }
-
-        // --------------- Search vertical down-lines --------------- //
-
-        int temp_length_down = 0;
-        uint8_t future_pixel_down = 255;
-        for (int j = y; j >= 1; j--)
-        {
-            uint8_t next_pixel = bin_barcode.ptr<uint8_t>(j - 1)[x];
-            temp_length_down++;
-            if (next_pixel == future_pixel_down)
-            {
-                future_pixel_down = static_cast<uint8_t>(~future_pixel_down);
-                test_lines.push_back(temp_length_down);
-                temp_length_down = 0;
-                if (test_lines.size() == 6)
-                    break;
-            }
-        }
-
-        // --------------- Compute vertical lines --------------- //
-
-        if (test_lines.size() == 6)
-        {
-            double length = 0.0, weight = 0.0;  // TODO avoid 'double' calculations
-
-            for (size_t i = 0; i < test_lines.size(); i++)
-                length += test_lines[i];
-
-            CV_Assert(length > 0);
-            for (size_t i = 0; i < test_lines.size(); i++)
-            {
-                if (i % 3 != 0)
-                {
-                    weight += fabs((test_lines[i] / length) - 1.0/ 7.0);
-                }
-                else
-                {
-                    weight += fabs((test_lines[i] / length) - 3.0/14.0);
-                }
-            }
-
-            if (weight < eps)
-            {
-                result.push_back(list_lines[pnt]);
-            }
-        }
-    }
-
-    vector<Point2f> point2f_result;
-    if (result.size() > 2)
-    {
-        for (size_t i = 0; i < result.size(); i++)
-        {
-            point2f_result.push_back(
-                  Point2f(static_cast<float>(result[i][0] + result[i][2] * 0.5),
-                          static_cast<float>(result[i][1])));
-        }
-    }
-    return point2f_result;
+    return selectVerticalLines(list_lines, computeVerticalDeviations(bin_barcode, list_lines), eps);
 }
 
 void QRDetect::fixationPoints(vector<Point2f> &local_point)
@@ -461,82 +512,129 @@ void QRDetect::fixationPoints(vector<Point2f> &local_point)
     }
 }
 
-bool QRDetect::localization()
+bool QRDetect::searchLocalizationPoints()
 {
     CV_TRACE_FUNCTION();
-    Point2f begin, end;
+    localization_points.clear();
     vector<Vec3d> list_lines_x = searchHorizontalLines();
-    vector<Point2f> list_lines_y;
+    if (list_lines_x.empty()) { return false; }
+    vector<Point2f> list_lines_y = separateVerticalLines(list_lines_x);
+    if (list_lines_y.empty()) { return false; }
+
     Mat labels;
-    if (!list_lines_x.empty())
-    {
-        list_lines_y = separateVerticalLines(list_lines_x);
-        if (!list_lines_y.empty())
-        {
-            kmeans(list_lines_y, 3, labels,
-                TermCriteria( TermCriteria::EPS + TermCriteria::COUNT, 10, 0.1),
-                3, KMEANS_PP_CENTERS, localization_points);
+    kmeans(list_lines_y, 3, labels,
+           TermCriteria( TermCriteria::EPS + TermCriteria::COUNT, 10, 0.1),
+           3, KMEANS_PP_CENTERS, localization_points);
+
+    fixationPoints(localization_points);
+    return localization_points.size() == 3;
+}
 
-            fixationPoints(localization_points);
+// The localization points found in the shrunk image are scaled up with the error of the scale factor.
+// The finder patterns are searched again at full resolution in the neighbourhood of every point,
+// these neighbourhoods of the scaled up binary image are replaced with the full resolution ones.
+void QRDetect::refineLocalizationPoints()
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(localization_points.size() == 3);
+    double min_dist = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < localization_points.size(); i++)
+        min_dist = std::min(min_dist, norm(localization_points[i] - localization_points[(i + 1) % 3]));
+    // The finder pattern with its light border is 9 modules wide, there are at least 14 modules between the centers
+    const int radius = cvCeil(min_dist * 0.35 + 2 * coeff_expansion);
+    const Rect image_rect = Rect(0, 0, barcode.cols, barcode.rows) & Rect(0, 0, bin_barcode.cols, bin_barcode.rows);
+
+    vector<Rect> rois(localization_points.size());
+    vector<Mat> bin_rois(localization_points.size());
+    parallel_for_(Range(0, (int)localization_points.size()), [&](const Range& range) {
+        for (int i = range.start; i < range.end; i++)
+        {
+            const Point2f center = localization_points[i];
+            const Rect roi = Rect(cvRound(center.x) - radius, cvRound(center.y) - radius,
+                                  2 * radius + 1, 2 * radius + 1) & image_rect;
+            if (roi.width < 7 || roi.height < 7)
+                continue;
+            // The neighbourhood contains the finder pattern and its light border, a global threshold fits
+            Mat bin_roi;
+            threshold(barcode(roi), bin_roi, 0, 255, THRESH_BINARY | THRESH_OTSU);
+            const vector<Vec3d> lines = cv::searchHorizontalLines(bin_roi, eps_vertical);
+            const vector<double> deviations = computeVerticalDeviations(bin_roi, lines);
+            Point2f sum(0, 0);
+            int count = 0;
+            for (size_t k = 0; k < lines.size(); k++)
+            {
+                if (deviations[k] >= eps_horizontal)
+                    continue;
+                const Point2f p(static_cast<float>(roi.x + lines[k][0] + lines[k][2] * 0.5),
+                                static_cast<float>(roi.y + lines[k][1]));
+                if (norm(p - center) < radius * 0.5)
+                {
+                    sum += p;
+                    count++;
+                }
+            }
+            if (count > 0)
+            {
+                localization_points[i] = sum / count;
+                rois[i] = roi;
+                bin_rois[i] = bin_roi;
+            }
         }
-    }
+    });
 
-    if (labels.empty())
+    for (size_t i = 0; i < rois.size(); i++)
     {
-        localization_points.clear();
+        if (!bin_rois[i].empty())
+            bin_rois[i].copyTo(bin_barcode(rois[i]));
     }
+}
 
-    bool square_flag = false, local_points_flag = false;
-    double triangle_sides[3];
-    double triangle_perim, square_area, img_square_area;
-    if (localization_points.size() == 3)
+bool QRDetect::localization()
+{
+    CV_TRACE_FUNCTION();
+    if (purpose == SHRINKING)
     {
-        triangle_sides[0] = norm(localization_points[0] - localization_points[1]);
-        triangle_sides[1] = norm(localization_points[1] - localization_points[2]);
-        triangle_sides[2] = norm(localization_points[2] - localization_points[0]);
+        // Coarse search in the shrunk image first, the full resolution is binarized and scanned
+        // only if nothing is found there
+        bin_barcode = resized_bin_barcode.clone();
+        if (searchLocalizationPoints())
+        {
+            const int width  = cvRound(bin_barcode.size().width  * coeff_expansion);
+            const int height = cvRound(bin_barcode.size().height * coeff_expansion);
+            Size new_size(width, height);
+            Mat intermediate;
+            resize(bin_barcode, intermediate, new_size, 0, 0, INTER_LINEAR_EXACT);
+            bin_barcode = intermediate;
+            for (size_t i = 0; i < localization_points.size(); i++)
+            {
+                localization_points[i] *= coeff_expansion;
+            }
+            refineLocalizationPoints();
+        }
+        else
+        {
+            adaptiveThreshold(barcode, bin_barcode, 255, ADAPTIVE_THRESH_GAUSSIAN_C, THRESH_BINARY, 83, 2);
+            if (!searchLocalizationPoints()) { return false; }
 
-        triangle_perim = (triangle_sides[0] + triangle_sides[1] + triangle_sides[2]) / 2;
+            double triangle_sides[3];
+            triangle_sides[0] = norm(localization_points[0] - localization_points[1]);
+            triangle_sides[1] = norm(localization_points[1] - localization_points[2]);
+            triangle_sides[2] = norm(localization_points[2] - localization_points[0]);
 
-        square_area = sqrt((triangle_perim * (triangle_perim - triangle_sides[0])
-                                           * (triangle_perim - triangle_sides[1])
-                                           * (triangle_perim - triangle_sides[2]))) * 2;
-        img_square_area = bin_barcode.cols * bin_barcode.rows;
+            const double triangle_perim = (triangle_sides[0] + triangle_sides[1] + triangle_sides[2]) / 2;
 
-        if (square_area > (img_square_area * 0.2))
-        {
-            square_flag = true;
+            const double square_area = sqrt((triangle_perim * (triangle_perim - triangle_sides[0])
+                                                            * (triangle_perim - triangle_sides[1])
+                                                            * (triangle_perim - triangle_sides[2]))) * 2;
+            const double img_square_area = bin_barcode.cols * bin_barcode.rows;
+
+            // such a large code would be found in the shrunk image
+            if (square_area > (img_square_area * 0.2)) { return false; }
         }
     }
     else
     {
-        local_points_flag = true;
-    }
-    if ((square_flag || local_points_flag) && purpose == SHRINKING)
-    {
-        localization_points.clear();
-        bin_barcode = resized_bin_barcode.clone();
-        list_lines_x = searchHorizontalLines();
-        if( list_lines_x.empty() ) { return false; }
-        list_lines_y = separateVerticalLines(list_lines_x);
-        if( list_lines_y.empty() ) { return false; }
-
-        kmeans(list_lines_y, 3, labels,
-               TermCriteria( TermCriteria::EPS + TermCriteria::COUNT, 10, 0.1),
-               3, KMEANS_PP_CENTERS, localization_points);
-
-        fixationPoints(localization_points);
-        if (localization_points.size() != 3) { return false; }
-
-        const int width  = cvRound(bin_barcode.size().width  * coeff_expansion);
-        const int height = cvRound(bin_barcode.size().height * coeff_expansion);
-        Size new_size(width, height);
-        Mat intermediate;
-        resize(bin_barcode, intermediate, new_size, 0, 0, INTER_LINEAR_EXACT);
-        bin_barcode = intermediate.clone();
-        for (size_t i = 0; i < localization_points.size(); i++)
-        {
-            localization_points[i] *= coeff_expansion;
-        }
+        searchLocalizationPoints();
     }
     if (purpose == ZOOMING)
     {
@@ -573,9 +671,11 @@ bool QRDetect::computeTransformationPoints()
 
     vector<Point> locations, non_zero_elem[3], newHull;
     vector<Point2f> new_non_zero_elem[3];
+    Mat mask = Mat::zeros(bin_barcode.rows + 2, bin_barcode.cols + 2, CV_8UC1);
+    const Rect mask_roi(1, 1, bin_barcode.cols - 2, bin_barcode.rows - 2);
     for (size_t i = 0; i < 3; i++)
     {
-        Mat mask = Mat::zeros(bin_barcode.rows + 2, bin_barcode.cols + 2, CV_8UC1);
+        Rect filled;
         uint8_t next_pixel, future_pixel = 255;
         int count_test_lines = 0, index_c = max(0, min(cvRound(localization_points[i].x), bin_barcode.cols - 1));
         const int index_r = max(0, min(cvRound(localization_points[i].y), bin_barcode.rows - 1));
@@ -590,13 +690,23 @@ bool QRDetect::computeTransformationPoints()
                 {
                     floodFill(bin_barcode, mask,
                               Point(index_c + 1, index_r), 255,
-                              0, Scalar(), Scalar(), FLOODFILL_MASK_ONLY);
+                              &filled, Scalar(), Scalar(), FLOODFILL_MASK_ONLY);
                     break;
                 }
             }
         }
-        Mat mask_roi = mask(Range(1, bin_barcode.rows - 1), Range(1, bin_barcode.cols - 1));
-        findNonZero(mask_roi, non_zero_elem[i]);
+        // Only the filled area is looked through, the mask is cleaned up for the next pattern
+        const Rect filled_mask(filled.x + 1, filled.y + 1, filled.width, filled.height);
+        const Rect search_roi = filled_mask & mask_roi;
+        if (!search_roi.empty())
+        {
+            findNonZero(mask(search_roi), non_zero_elem[i]);
+            const Point offset = search_roi.tl() - mask_roi.tl();
+            for (size_t k = 0; k < non_zero_elem[i].size(); k++)
+                non_zero_elem[i][k] += offset;
+        }
+        if (!filled_mask.empty())
+            mask(filled_mask).setTo(Scalar::all(0));
         newHull.insert(newHull.end(), non_zero_elem[i].begin(), non_zero_elem[i].end());
     }
     convexHull(newHull, locations);
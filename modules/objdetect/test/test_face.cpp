@@ -144,6 +144,37 @@ TEST(Objdetect_face_detection, regression)
     }
 }
 
+TEST(Objdetect_face_detection, batch)
+{
+    std::string model = findDataFile("dnn/onnx/models/yunet-202303.onnx", false);
+    Mat image = imread(findDataFile("cv/shared/lena.png"));
+    ASSERT_FALSE(image.empty());
+
+    Ptr<FaceDetectorYN> faceDetector = FaceDetectorYN::create(model, "", image.size());
+    faceDetector->setScoreThreshold(0.7f);
+    Mat ref;
+    faceDetector->detect(image, ref);
+    ASSERT_GT(ref.rows, 0);
+
+    // The last image is twice as large, it is downscaled to the input size and the results are scaled back
+    Mat image2x;
+    resize(image, image2x, Size(), 2, 2, INTER_LINEAR);
+    std::vector<Mat> images = { image, Mat(), image, image2x };
+    std::vector<Mat> faces;
+    faceDetector->detectBatch(images, faces);
+    ASSERT_EQ(images.size(), faces.size());
+
+    EXPECT_TRUE(faces[1].empty());
+    for (size_t i : { 0, 2 })
+    {
+        ASSERT_EQ(ref.size(), faces[i].size()) << "image " << i;
+        EXPECT_LE(cvtest::norm(ref, faces[i], NORM_INF), 1e-2) << "image " << i;
+    }
+    ASSERT_EQ(ref.rows, faces[3].rows);
+    Mat ref2x = ref.colRange(0, 14) * 2;
+    EXPECT_LE(cvtest::norm(ref2x, faces[3].colRange(0, 14), NORM_INF), 4);
+}
+
 TEST(Objdetect_face_recognition, regression)
 {
     // Pre-set params
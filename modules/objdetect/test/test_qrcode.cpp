@@ -461,6 +461,41 @@ TEST(Objdetect_QRCode_detect, detect_regression_20882)
     EXPECT_NO_THROW(qrcode.decode(src, corners, straight_barcode));
 }
 
+TEST(Objdetect_QRCode_detect, large_image)
+{
+    // The code is found in the shrunk image, the corners are refined at full resolution
+    const int versions[] = { 1, 3, 7 };
+    for (int version : versions)
+    {
+        Mat qrImg;
+        QRCodeEncoder::Params params;
+        params.version = version;
+        Ptr<QRCodeEncoder> qrcode_enc = cv::QRCodeEncoder::create(params);
+        qrcode_enc->encode("OpenCV", qrImg);
+
+        Mat code;
+        cv::resize(qrImg, code, qrImg.size() * 20, 1.0, 1.0, INTER_NEAREST);
+        Mat src(3000, 4000, CV_8UC1, Scalar(255));  // 12 MP
+        const Point offset(1500, 900);
+        code.copyTo(src(Rect(offset, code.size())));
+        const Rect expected = boundingRect(Mat(255 - code)) + offset;
+
+        QRCodeDetector qrcode;
+        std::vector<Point2f> corners;
+        ASSERT_TRUE(qrcode.detect(src, corners)) << "version=" << version;
+        ASSERT_EQ(4u, corners.size());
+        const Point2f expected_corners[] = {
+            Point2f((float)expected.x, (float)expected.y), Point2f((float)expected.br().x, (float)expected.y),
+            Point2f((float)expected.br().x, (float)expected.br().y), Point2f((float)expected.x, (float)expected.br().y)
+        };
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_NEAR(expected_corners[i].x, corners[i].x, 3.f) << "version=" << version << " corner=" << i;
+            EXPECT_NEAR(expected_corners[i].y, corners[i].y, 3.f) << "version=" << version << " corner=" << i;
+        }
+    }
+}
+
 TEST(Objdetect_QRCode_basic, not_found_qrcode)
 {
     std::vector<Point> corners;
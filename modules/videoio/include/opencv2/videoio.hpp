@@ -157,7 +157,8 @@ enum VideoCaptureProperties {
        CAP_PROP_GAIN          =14, //!< Gain of the image (only for those cameras that support).
        CAP_PROP_EXPOSURE      =15, //!< Exposure (only for those cameras that support).
        CAP_PROP_CONVERT_RGB   =16, //!< Boolean flags indicating whether images should be converted to RGB. <br/>
-                                   //!< *GStreamer note*: The flag is ignored in case if custom pipeline is used. It's user responsibility to interpret pipeline output.
+                                   //!< *GStreamer note*: The flag is ignored in case if custom pipeline is used. It's user responsibility to interpret pipeline output. <br/>
+                                   //!< *FFmpeg note*: When disabled, YUV 4:2:0 frames are returned without conversion as CV_8UC1 images with height*3/2 rows in I420 or NV12/NV21 layout (see CAP_PROP_CODEC_PIXEL_FORMAT), ready for cv::cvtColor.
        CAP_PROP_WHITE_BALANCE_BLUE_U =17, //!< Currently unsupported.
        CAP_PROP_RECTIFICATION =18, //!< Rectification flag for stereo cameras (note: only supported by DC1394 v 2.x backend currently).
        CAP_PROP_MONOCHROME    =19,
@@ -210,7 +211,12 @@ enum VideoCaptureProperties {
        CAP_PROP_LRF_HAS_KEY_FRAME = 67, //!< FFmpeg back-end only - Indicates whether the Last Raw Frame (LRF), output from VideoCapture::read() when VideoCapture is initialized with VideoCapture::open(CAP_FFMPEG, {CAP_PROP_FORMAT, -1}) or VideoCapture::set(CAP_PROP_FORMAT,-1) is called before the first call to VideoCapture::read(), contains encoded data for a key frame.
        CAP_PROP_CODEC_EXTRADATA_INDEX = 68, //!< Positive index indicates that returning extra data is supported by the video back end.  This can be retrieved as cap.retrieve(data, <returned index>).  E.g. When reading from a h264 encoded RTSP stream, the FFmpeg backend could return the SPS and/or PPS if available (if sent in reply to a DESCRIBE request), from calls to cap.retrieve(data, <returned index>).
        CAP_PROP_FRAME_TYPE = 69, //!< (read-only) FFmpeg back-end only - Frame type ascii code (73 = 'I', 80 = 'P', 66 = 'B' or 63 = '?' if unknown) of the most recently read frame.
-       CAP_PROP_N_THREADS = 70, //!< (**open-only**) Set the maximum number of threads to use. Use 0 to use as many threads as CPU cores (applicable for FFmpeg back-end only).
+       CAP_PROP_N_THREADS = 70, //!< (**open-only**) Set the maximum number of threads to use. Use 0 to use as many threads as CPU cores (applicable for FFmpeg back-end only). CAP_OPENCV_MJPEG and CAP_IMAGES decode frames ahead in this number of threads if the property is set.
+       CAP_PROP_SEEK_INDEX = 71, //!< (**open-only**) FFmpeg back-end only - If non-zero, index the timestamps and key frames of the whole video stream on open, so seeking by CAP_PROP_POS_FRAMES / CAP_PROP_POS_MSEC decodes only from the nearest preceding key frame and CAP_PROP_FRAME_COUNT is exact. Reading returns 1 if the index is in use. Index files are cached in the directory specified by the OPENCV_FFMPEG_SEEK_INDEX_CACHE_DIR environment variable (if set).
+       CAP_PROP_PREFETCH_FRAMES = 72, //!< (**open-only**) If positive, frames are grabbed and retrieved on a background thread into a queue of this size, so decoding overlaps with processing. Works with any back-end, only the video channel (0) is available then.
+       CAP_PROP_PREFETCH_DROP_OLDEST = 73, //!< (**open-only**) If non-zero, the oldest prefetched frame is dropped when the queue is full (useful for live sources), otherwise prefetching waits for the frames to be read. See CAP_PROP_PREFETCH_FRAMES.
+       CAP_PROP_PREFETCH_DROPPED_FRAMES = 74, //!< (read-only) Number of prefetched frames dropped because of the full queue. See CAP_PROP_PREFETCH_DROP_OLDEST.
+       CAP_PROP_PREFETCH_LATENCY_MSEC = 75, //!< (read-only) Average time in milliseconds the prefetched frames waited in the queue before being grabbed. See CAP_PROP_PREFETCH_FRAMES.
 #ifndef CV_DOXYGEN
        CV__CAP_PROP_LATEST
 #endif
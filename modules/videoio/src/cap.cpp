@@ -63,6 +63,31 @@ static bool param_VIDEOWRITER_DEBUG = utils::getConfigurationParameterBool("OPEN
     }
 
 void DefaultDeleter<CvCapture>::operator ()(CvCapture* obj) const { cvReleaseCapture(&obj); }
+
+// Prefetching works on top of any backend, so its parameters are removed before passing the rest to backends
+static std::vector<int> extractPrefetchParameters(const std::vector<int>& params, int& prefetchFrames, bool& dropOldest)
+{
+    prefetchFrames = 0;
+    dropOldest = false;
+    if (params.size() % 2 != 0)
+        return params;  // reported by VideoCaptureParameters
+    std::vector<int> backendParams;
+    backendParams.reserve(params.size());
+    for (size_t i = 0; i < params.size(); i += 2)
+    {
+        if (params[i] == CAP_PROP_PREFETCH_FRAMES)
+            prefetchFrames = params[i + 1];
+        else if (params[i] == CAP_PROP_PREFETCH_DROP_OLDEST)
+            dropOldest = params[i + 1] != 0;
+        else
+        {
+            backendParams.push_back(params[i]);
+            backendParams.push_back(params[i + 1]);
+        }
+    }
+    CV_CheckGE(prefetchFrames, 0, "VIDEOIO: CAP_PROP_PREFETCH_FRAMES must be non-negative");
+    return backendParams;
+}
 void DefaultDeleter<CvVideoWriter>::operator ()(CvVideoWriter* obj) const { cvReleaseVideoWriter(&obj); }
 
 
@@ -115,7 +140,9 @@ bool VideoCapture::open(const String& filename, int apiPreference, const std::ve
         release();
     }
 
-    const VideoCaptureParameters parameters(params);
+    int prefetchFrames = 0;
+    bool prefetchDropOldest = false;
+    const VideoCaptureParameters parameters(extractPrefetchParameters(params, prefetchFrames, prefetchDropOldest));
     const std::vector<VideoBackendInfo> backends = cv::videoio_registry::getAvailableBackends_CaptureByFilename();
     for (size_t i = 0; i < backends.size(); i++)
     {
@@ -144,6 +171,8 @@ bool VideoCapture::open(const String& filename, int apiPreference, const std::ve
                                                         info.name, icap->isOpened()));
                         if (icap->isOpened())
                         {
+                            if (prefetchFrames > 0)
+                                icap = createPrefetchingCapture(icap, prefetchFrames, prefetchDropOldest);
                             return true;
                         }
                         icap.release();
@@ -253,7 +282,9 @@ bool VideoCapture::open(int cameraNum, int apiPreference, const std::vector<int>
         }
     }
 
-    const VideoCaptureParameters parameters(params);
+    int prefetchFrames = 0;
+    bool prefetchDropOldest = false;
+    const VideoCaptureParameters parameters(extractPrefetchParameters(params, prefetchFrames, prefetchDropOldest));
     const std::vector<VideoBackendInfo> backends = cv::videoio_registry::getAvailableBackends_CaptureByIndex();
     for (size_t i = 0; i < backends.size(); i++)
     {
@@ -282,6 +313,8 @@ bool VideoCapture::open(int cameraNum, int apiPreference, const std::vector<int>
                                                         info.name, icap->isOpened()));
                         if (icap->isOpened())
                         {
+                            if (prefetchFrames > 0)
+                                icap = createPrefetchingCapture(icap, prefetchFrames, prefetchDropOldest);
                             return true;
                         }
                         icap.release();
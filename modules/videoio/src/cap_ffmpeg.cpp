@@ -90,9 +90,6 @@ public:
     }
     virtual bool retrieveFrame(int flag, cv::OutputArray frame) CV_OVERRIDE
     {
-        unsigned char* data = 0;
-        int step=0, width=0, height=0, cn=0, depth=0;
-
         if (!ffmpegCapture)
             return false;
 
@@ -103,18 +100,11 @@ public:
             }
         }
 
-        if (flag == 0) {
-            if (!icvRetrieveFrame2_FFMPEG_p(ffmpegCapture, &data, &step, &width, &height, &cn, &depth))
-                return false;
-        }
-        else {
-            if (!ffmpegCapture->retrieveFrame(flag, &data, &step, &width, &height, &cn, &depth))
-                return false;
-        }
+        // decoded frame is converted (or copied) straight into the output
+        if (!ffmpegCapture->retrieveFrame(flag, frame))
+            return false;
 
-        cv::Mat tmp(height, width, CV_MAKETYPE(depth, cn), data, step);
-        applyMetadataRotation(*this, tmp);
-        tmp.copyTo(frame);
+        applyMetadataRotation(*this, frame);
 
         return true;
     }
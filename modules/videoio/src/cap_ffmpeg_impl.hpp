@@ -51,8 +51,10 @@ using namespace cv;
 # include <pthread.h>
 #endif
 #include <algorithm>
+#include <fstream>
 #include <limits>
 #include <string.h>
+#include <sys/stat.h>
 
 #ifndef __OPENCV_BUILD
 #define CV_FOURCC(c1, c2, c3, c4) (((c1) & 255) + (((c2) & 255) << 8) + (((c3) & 255) << 16) + (((c4) & 255) << 24))
@@ -247,6 +249,17 @@ inline static AVRational av_make_q(int num, int den)
 #define USE_AV_INTERRUPT_CALLBACK 1
 #endif
 
+#ifndef USE_AV_SWS_THREADS
+// APIchanges:
+// 2021-09-20 - lsws 6.1.100 - swscale.h
+//   Add AVFrame-based API sws_scale_frame() (slice threading is controlled by the "threads" option)
+#if LIBSWSCALE_BUILD >= CALC_FFMPEG_VERSION(6, 1, 100)
+#define USE_AV_SWS_THREADS 1
+#else
+#define USE_AV_SWS_THREADS 0
+#endif
+#endif
+
 #ifndef USE_AV_SEND_FRAME_API
 // https://github.com/FFmpeg/FFmpeg/commit/7fc329e2dd6226dfecaa4a1d7adf353bf2773726
 #if LIBAVCODEC_VERSION_MICRO >= 100 \
@@ -524,6 +537,110 @@ inline static std::string _opencv_ffmpeg_get_error_string(int error_code)
         return std::string("Unknown error");
 }
 
+// Timestamps of all packets of the video stream, collected by demuxing the whole file (no decoding).
+// Allows seeking straight to the key frame preceding the requested frame, see CAP_PROP_SEEK_INDEX.
+struct FFmpegSeekIndex
+{
+    std::vector<int64_t> frame_pts;  // frame number -> timestamp, presentation order
+    std::vector<int64_t> key_pts;    // timestamps of key frames, sorted
+
+    bool empty() const { return frame_pts.empty(); }
+    void clear() { frame_pts.clear(); key_pts.clear(); }
+
+    bool build(AVFormatContext* ic, int stream_index);
+    bool load(const std::string& path, int64_t file_size, int64_t file_mtime);
+    bool save(const std::string& path, int64_t file_size, int64_t file_mtime) const;
+
+    // Number of the frame with the given timestamp (or the next frame if there is no exact match)
+    int64_t frameNumber(int64_t pts) const
+    {
+        return std::lower_bound(frame_pts.begin(), frame_pts.end(), pts) - frame_pts.begin();
+    }
+    // Timestamp of the latest key frame which doesn't follow the given frame
+    int64_t keyFramePts(int64_t frame) const
+    {
+        const int64_t pts = frame_pts[(size_t)frame];
+        std::vector<int64_t>::const_iterator it = std::upper_bound(key_pts.begin(), key_pts.end(), pts);
+        return it == key_pts.begin() ? frame_pts[0] : *(it - 1);
+    }
+};
+
+bool FFmpegSeekIndex::build(AVFormatContext* ic, int stream_index)
+{
+    clear();
+    AVPacket pkt;
+    memset(&pkt, 0, sizeof(pkt));
+    av_init_packet(&pkt);
+    bool ok = true;
+    while (av_read_frame(ic, &pkt) >= 0)
+    {
+        if (pkt.stream_index == stream_index)
+        {
+            const int64_t pts = pkt.pts != AV_NOPTS_VALUE_ ? pkt.pts : pkt.dts;
+            if (pts == AV_NOPTS_VALUE_)
+            {
+                ok = false;
+                _opencv_ffmpeg_av_packet_unref(&pkt);
+                break;
+            }
+            frame_pts.push_back(pts);
+            if (pkt.flags & AV_PKT_FLAG_KEY)
+                key_pts.push_back(pts);
+        }
+        _opencv_ffmpeg_av_packet_unref(&pkt);
+    }
+    if (!ok || key_pts.empty())
+    {
+        clear();
+        return false;
+    }
+    std::sort(frame_pts.begin(), frame_pts.end());
+    std::sort(key_pts.begin(), key_pts.end());
+    return true;
+}
+
+static const char ffmpeg_seek_index_signature[8] = { 'O', 'C', 'V', 'S', 'I', 'D', 'X', '1' };
+
+bool FFmpegSeekIndex::load(const std::string& path, int64_t file_size, int64_t file_mtime)
+{
+    clear();
+    std::ifstream f(path.c_str(), std::ios::binary);
+    if (!f.is_open())
+        return false;
+    char signature[sizeof(ffmpeg_seek_index_signature)] = {};
+    int64_t header[4] = {};  // file size, modification time, number of frames, number of key frames
+    f.read(signature, sizeof(signature));
+    f.read((char*)header, sizeof(header));
+    if (!f || memcmp(signature, ffmpeg_seek_index_signature, sizeof(signature)) != 0 ||
+        header[0] != file_size || header[1] != file_mtime ||
+        header[2] <= 0 || header[3] <= 0 || header[3] > header[2] || header[2] > file_size)
+        return false;
+    frame_pts.resize((size_t)header[2]);
+    key_pts.resize((size_t)header[3]);
+    f.read((char*)&frame_pts[0], frame_pts.size() * sizeof(int64_t));
+    f.read((char*)&key_pts[0], key_pts.size() * sizeof(int64_t));
+    if (!f)
+    {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+bool FFmpegSeekIndex::save(const std::string& path, int64_t file_size, int64_t file_mtime) const
+{
+    CV_Assert(!empty());
+    std::ofstream f(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!f.is_open())
+        return false;
+    const int64_t header[4] = { file_size, file_mtime, (int64_t)frame_pts.size(), (int64_t)key_pts.size() };
+    f.write(ffmpeg_seek_index_signature, sizeof(ffmpeg_seek_index_signature));
+    f.write((const char*)header, sizeof(header));
+    f.write((const char*)&frame_pts[0], frame_pts.size() * sizeof(int64_t));
+    f.write((const char*)&key_pts[0], key_pts.size() * sizeof(int64_t));
+    return !f.fail();
+}
+
 struct CvCapture_FFMPEG
 {
     bool open(const char* filename, const VideoCaptureParameters& params);
@@ -533,6 +650,7 @@ struct CvCapture_FFMPEG
     bool setProperty(int, double);
     bool grabFrame();
     bool retrieveFrame(int flag, unsigned char** data, int* step, int* width, int* height, int* cn, int* depth);
+    bool retrieveFrame(int flag, cv::OutputArray output);
     bool retrieveHWFrame(cv::OutputArray output);
     void rotateFrame(cv::Mat &mat) const;
 
@@ -541,6 +659,8 @@ struct CvCapture_FFMPEG
     void    seek(int64_t frame_number);
     void    seek(double sec);
     bool    slowSeek( int framenumber );
+    bool    seekWithIndex(int64_t frame_number);
+    bool    initSeekIndex(const char* filename);
 
     int64_t get_total_frames() const;
     double  get_duration_sec() const;
@@ -552,6 +672,11 @@ struct CvCapture_FFMPEG
     double  dts_to_sec(int64_t dts) const;
     void    get_rotation_angle();
 
+    AVFrame* acquireSwPicture();
+    void    releaseSwPicture(AVFrame*& sw_picture);
+    bool    convertFrame(AVFrame* sw_picture, unsigned char** data, int* step, int* width, int* height, int* cn, int* depth);
+    bool    convertFrameToBGR(AVFrame* sw_picture, cv::Mat& dst);
+
     AVFormatContext * ic;
     AVCodec         * avcodec;
     AVCodecContext  * context;
@@ -564,8 +689,12 @@ struct CvCapture_FFMPEG
     AVPacket          packet;
     Image_FFMPEG      frame;
     struct SwsContext *img_convert_ctx;
+    // BGR conversion straight into the caller's buffer, see convertFrameToBGR()
+    struct SwsContext *sws_direct_ctx;
+    int sws_direct_width, sws_direct_height, sws_direct_format;
 
     int64_t frame_number, first_frame_number;
+    FFmpegSeekIndex* seek_index;  // optional, see CAP_PROP_SEEK_INDEX
 
     bool   rotation_auto;
     int    rotation_angle; // valid 0, 90, 180, 270
@@ -616,12 +745,16 @@ void CvCapture_FFMPEG::init()
     picture = 0;
     picture_pts = AV_NOPTS_VALUE_;
     first_frame_number = -1;
+    seek_index = 0;
     memset( &rgb_picture, 0, sizeof(rgb_picture) );
     memset( &frame, 0, sizeof(frame) );
     filename = 0;
     memset(&packet, 0, sizeof(packet));
     av_init_packet(&packet);
     img_convert_ctx = 0;
+    sws_direct_ctx = 0;
+    sws_direct_width = sws_direct_height = 0;
+    sws_direct_format = -1;
 
     avcodec = 0;
     context = 0;
@@ -664,6 +797,17 @@ void CvCapture_FFMPEG::close()
         img_convert_ctx = 0;
     }
 
+    if( sws_direct_ctx )
+    {
+        sws_freeContext(sws_direct_ctx);
+        sws_direct_ctx = 0;
+        sws_direct_width = sws_direct_height = 0;
+        sws_direct_format = -1;
+    }
+
+    delete seek_index;
+    seek_index = 0;
+
     if( picture )
     {
 #if LIBAVCODEC_BUILD >= (LIBAVCODEC_VERSION_MICRO >= 100 \
@@ -1035,6 +1179,7 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
     unsigned i;
     bool valid = false;
     int nThreads = 0;
+    bool useSeekIndex = false;
 
     close();
 
@@ -1045,8 +1190,9 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
         {
             CV_LOG_WARNING(NULL, "VIDEOIO/FFMPEG: BGR conversion turned OFF, decoded frame will be "
                                  "returned in its original format. "
-                                 "Multiplanar formats are not supported by the backend. "
-                                 "Only GRAY8/GRAY16LE pixel formats have been tested. "
+                                 "YUV420P/NV12/NV21 frames are returned as single-channel I420/NV12/NV21 images, "
+                                 "other multiplanar formats are not supported by the backend. "
+                                 "Only GRAY8/GRAY16LE and YUV 4:2:0 pixel formats have been tested. "
                                  "Use at your own risk.");
         }
         if (params.has(CAP_PROP_FORMAT))
@@ -1107,6 +1253,10 @@ bool CvCapture_FFMPEG::open(const char* _filename, const VideoCaptureParameters&
         {
             nThreads = params.get<int>(CAP_PROP_N_THREADS);
         }
+        if (params.has(CAP_PROP_SEEK_INDEX))
+        {
+            useSeekIndex = params.get<bool>(CAP_PROP_SEEK_INDEX);
+        }
         if (params.warnUnusedParameters())
         {
             CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: unsupported parameters in .open(), see logger INFO channel for details. Bailout");
@@ -1352,6 +1502,10 @@ exit_func:
     interrupt_metadata.timeout_after_ms = 0;
 #endif
 
+    // NB: after the open timeout is deactivated, demuxing of a long file may take a while
+    if (valid && useSeekIndex && !rawMode)
+        valid = initSeekIndex(_filename);
+
     if( !valid )
         close();
 
@@ -1633,6 +1787,19 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         return  ret;
     }
 
+    AVFrame* sw_picture = acquireSwPicture();
+    if (!sw_picture)
+        return false;
+
+    const bool ret = convertFrame(sw_picture, data, step, width, height, cn, depth);
+    releaseSwPicture(sw_picture);
+    return ret;
+}
+
+// Returns the decoded picture in system memory: 'picture' itself or its copy downloaded from GPU.
+// The result must be passed to releaseSwPicture().
+AVFrame* CvCapture_FFMPEG::acquireSwPicture()
+{
     AVFrame* sw_picture = picture;
 #if USE_AV_HW_CODECS
     // if hardware frame, copy it to system memory
@@ -1641,14 +1808,30 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
         //if (av_hwframe_map(sw_picture, picture, AV_HWFRAME_MAP_READ) < 0) {
         if (av_hwframe_transfer_data(sw_picture, picture, 0) < 0) {
             CV_LOG_ERROR(NULL, "Error copying data from GPU to CPU (av_hwframe_transfer_data)");
-            return false;
+            av_frame_free(&sw_picture);
+            return NULL;
         }
     }
 #endif
 
-    if (!sw_picture || !sw_picture->data[0])
-        return false;
+    if (sw_picture && !sw_picture->data[0])
+        releaseSwPicture(sw_picture);
+    return sw_picture;
+}
+
+void CvCapture_FFMPEG::releaseSwPicture(AVFrame*& sw_picture)
+{
+#if USE_AV_HW_CODECS
+    if (sw_picture && sw_picture != picture)
+    {
+        av_frame_free(&sw_picture);
+    }
+#endif
+    sw_picture = NULL;
+}
 
+bool CvCapture_FFMPEG::convertFrame(AVFrame* sw_picture, unsigned char** data, int* step, int* width, int* height, int* cn, int* depth)
+{
     CV_LOG_DEBUG(NULL, "Input picture format: " << av_get_pix_fmt_name((AVPixelFormat)sw_picture->format));
     const AVPixelFormat result_format = convertRGB ? AV_PIX_FMT_BGR24 : (AVPixelFormat)sw_picture->format;
     switch (result_format)
@@ -1725,15 +1908,174 @@ bool CvCapture_FFMPEG::retrieveFrame(int flag, unsigned char** data, int* step,
     *width = frame.width;
     *height = frame.height;
 
-#if USE_AV_HW_CODECS
-    if (sw_picture != picture)
-    {
-        av_frame_free(&sw_picture);
+    return true;
+}
+
+#if USE_AV_SWS_THREADS
+static void ffmpeg_buffer_no_free(void* /*opaque*/, uint8_t* /*data*/) {}
+#endif
+
+// Converts the picture to BGR writing straight into 'dst', without the intermediate 'rgb_picture' buffer.
+// With libswscale 6.1+ the conversion is split into slices processed in parallel,
+// the number of threads follows the decoder's one (CAP_PROP_N_THREADS, 0 means auto).
+bool CvCapture_FFMPEG::convertFrameToBGR(AVFrame* sw_picture, cv::Mat& dst)
+{
+    const int width = sw_picture->width, height = sw_picture->height;
+    // SIMD converters of libswscale process rows by blocks of pixels and may write past the row end,
+    // so the caller's buffer is used only if it doesn't need padding (see also coded_width in convertFrame())
+    if (width <= 0 || height <= 0 || width % 16 != 0)
+        return false;
+
+    const AVPixelFormat src_format = (AVPixelFormat)sw_picture->format;
+    if (sws_direct_ctx == NULL ||
+        sws_direct_width != width ||
+        sws_direct_height != height ||
+        sws_direct_format != (int)src_format)
+    {
+        if (sws_direct_ctx)
+            sws_freeContext(sws_direct_ctx);
+#if USE_AV_SWS_THREADS
+        sws_direct_ctx = sws_alloc_context();
+        if (sws_direct_ctx)
+        {
+            av_opt_set_int(sws_direct_ctx, "srcw", width, 0);
+            av_opt_set_int(sws_direct_ctx, "srch", height, 0);
+            av_opt_set_int(sws_direct_ctx, "src_format", src_format, 0);
+            av_opt_set_int(sws_direct_ctx, "dstw", width, 0);
+            av_opt_set_int(sws_direct_ctx, "dsth", height, 0);
+            av_opt_set_int(sws_direct_ctx, "dst_format", AV_PIX_FMT_BGR24, 0);
+            av_opt_set_int(sws_direct_ctx, "sws_flags", SWS_BICUBIC, 0);
+            av_opt_set_int(sws_direct_ctx, "threads", context->thread_count, 0);
+            if (sws_init_context(sws_direct_ctx, NULL, NULL) < 0)
+            {
+                sws_freeContext(sws_direct_ctx);
+                sws_direct_ctx = NULL;
+            }
+        }
+#else
+        sws_direct_ctx = sws_getContext(
+                width, height, src_format,
+                width, height, AV_PIX_FMT_BGR24,
+                SWS_BICUBIC,
+                NULL, NULL, NULL
+                );
+#endif
+        if (sws_direct_ctx == NULL)
+        {
+            sws_direct_width = sws_direct_height = 0;
+            sws_direct_format = -1;
+            return false;
+        }
+        sws_direct_width = width;
+        sws_direct_height = height;
+        sws_direct_format = (int)src_format;
     }
+
+    dst.create(height, width, CV_8UC3);
+#if USE_AV_SWS_THREADS
+    AVFrame* dst_frame = av_frame_alloc();
+    if (!dst_frame)
+        return false;
+    dst_frame->format = AV_PIX_FMT_BGR24;
+    dst_frame->width = width;
+    dst_frame->height = height;
+    dst_frame->data[0] = dst.data;
+    dst_frame->linesize[0] = (int)dst.step;
+    // libswscale allocates the destination itself unless the frame is backed by a buffer
+    dst_frame->buf[0] = av_buffer_create(dst.data, (int)(dst.step * height), ffmpeg_buffer_no_free, NULL, 0);
+    const bool ret = dst_frame->buf[0] && sws_scale_frame(sws_direct_ctx, dst_frame, sw_picture) >= 0;
+    av_frame_free(&dst_frame);
+    return ret;
+#else
+    uint8_t* dst_data[AV_NUM_DATA_POINTERS] = { dst.data };
+    int dst_linesize[AV_NUM_DATA_POINTERS] = { (int)dst.step };
+    sws_scale(
+            sws_direct_ctx,
+            sw_picture->data,
+            sw_picture->linesize,
+            0, height,
+            dst_data,
+            dst_linesize
+            );
+    return true;
 #endif
+}
+
+// Copies the planes of a 4:2:0 picture as is into the single-channel layout expected by
+// cv::cvtColor(COLOR_YUV2BGR_I420 / COLOR_YUV2BGR_NV12 / COLOR_YUV2BGR_NV21): 'height * 3 / 2' rows,
+// the luma plane first, then the chroma plane(s) packed without gaps.
+static bool copyYUV420Planes(const AVFrame* src, cv::Mat& dst)
+{
+    const AVPixelFormat format = (AVPixelFormat)src->format;
+    const bool semiPlanar = format == AV_PIX_FMT_NV12 || format == AV_PIX_FMT_NV21;
+    if (!semiPlanar && format != AV_PIX_FMT_YUV420P && format != AV_PIX_FMT_YUVJ420P)
+        return false;
+    const int width = src->width, height = src->height;
+    if (width <= 0 || height <= 0 || width % 2 != 0 || height % 2 != 0)
+        return false;
+
+    dst.create(height * 3 / 2, width, CV_8UC1);
+    cv::Mat buf = dst.isContinuous() ? dst : cv::Mat(dst.size(), dst.type());
+    for (int y = 0; y < height; y++)
+        memcpy(buf.ptr(y), src->data[0] + (ptrdiff_t)y * src->linesize[0], width);
+    uchar* chroma = buf.ptr(height);
+    if (semiPlanar)
+    {
+        for (int y = 0; y < height / 2; y++)
+            memcpy(chroma + (size_t)y * width, src->data[1] + (ptrdiff_t)y * src->linesize[1], width);
+    }
+    else
+    {
+        const int chroma_width = width / 2, chroma_height = height / 2;
+        for (int plane = 1; plane <= 2; plane++)
+        {
+            for (int y = 0; y < chroma_height; y++)
+                memcpy(chroma + (size_t)y * chroma_width, src->data[plane] + (ptrdiff_t)y * src->linesize[plane], chroma_width);
+            chroma += (size_t)chroma_width * chroma_height;
+        }
+    }
+    if (buf.data != dst.data)
+        buf.copyTo(dst);
     return true;
 }
 
+bool CvCapture_FFMPEG::retrieveFrame(int flag, cv::OutputArray output)
+{
+    if (!video_st || (!rawMode && !context))
+        return false;
+
+    unsigned char* data = 0;
+    int step = 0, width = 0, height = 0, cn = 0, depth = 0;
+    if (rawMode || flag != 0)
+    {
+        if (!retrieveFrame(flag, &data, &step, &width, &height, &cn, &depth))
+            return false;
+        cv::Mat(height, width, CV_MAKETYPE(depth, cn), data, step).copyTo(output);
+        return true;
+    }
+
+    AVFrame* sw_picture = acquireSwPicture();
+    if (!sw_picture)
+        return false;
+
+    // Write into the caller's Mat directly if it is possible
+    const bool directOutput = output.kind() == cv::_InputArray::MAT && !output.fixedType() && !output.fixedSize();
+    cv::Mat tmp;
+    cv::Mat& dst = directOutput ? output.getMatRef() : tmp;
+    bool ret = convertRGB ? convertFrameToBGR(sw_picture, dst) : copyYUV420Planes(sw_picture, dst);
+    if (!ret)
+    {
+        ret = convertFrame(sw_picture, &data, &step, &width, &height, &cn, &depth);
+        if (ret)
+            cv::Mat(height, width, CV_MAKETYPE(depth, cn), data, step).copyTo(dst);
+    }
+    releaseSwPicture(sw_picture);
+
+    if (ret && !directOutput)
+        tmp.copyTo(output);
+    return ret;
+}
+
 bool CvCapture_FFMPEG::retrieveHWFrame(cv::OutputArray output)
 {
 #if USE_AV_HW_CODECS
@@ -1859,6 +2201,9 @@ double CvCapture_FFMPEG::getProperty( int property_id ) const
     case CAP_PROP_N_THREADS:
         if (!rawMode)
             return static_cast<double>(context->thread_count);
+        break;
+    case CAP_PROP_SEEK_INDEX:
+        return seek_index ? 1 : 0;
     default:
         break;
     }
@@ -1913,6 +2258,9 @@ double CvCapture_FFMPEG::get_fps() const
 
 int64_t CvCapture_FFMPEG::get_total_frames() const
 {
+    if (seek_index)
+        return (int64_t)seek_index->frame_pts.size();
+
     int64_t nbf = ic->streams[video_stream]->nb_frames;
 
     if (nbf == 0)
@@ -1953,10 +2301,94 @@ void CvCapture_FFMPEG::get_rotation_angle()
 #endif
 }
 
+// Builds the seek index or loads it from the cache.
+// Returns false if the input can't be rewound after the indexing.
+bool CvCapture_FFMPEG::initSeekIndex(const char* _filename)
+{
+    if (!ic->pb || !(ic->pb->seekable & AVIO_SEEKABLE_NORMAL))
+    {
+        CV_LOG_WARNING(NULL, "VIDEOIO/FFMPEG: seek index is not supported for non-seekable inputs");
+        return true;
+    }
+
+    seek_index = new FFmpegSeekIndex();
+
+    // Index files can be reused for local files only
+    const std::string cache_dir = utils::getConfigurationParameterString("OPENCV_FFMPEG_SEEK_INDEX_CACHE_DIR", "");
+    std::string cache_path;
+    int64_t file_size = 0, file_mtime = 0;
+    struct stat file_stat;
+    if (!cache_dir.empty() && _filename && stat(_filename, &file_stat) == 0)
+    {
+        file_size = (int64_t)file_stat.st_size;
+        file_mtime = (int64_t)file_stat.st_mtime;
+        uint64_t hash = 14695981039346656037ULL;  // FNV-1a of the file name
+        for (const char* c = _filename; *c; c++)
+            hash = (hash ^ (uchar)*c) * 1099511628211ULL;
+        cache_path = cv::format("%s/%016llx_%d.seekidx", cache_dir.c_str(), (unsigned long long)hash, video_stream);
+        if (seek_index->load(cache_path, file_size, file_mtime))
+        {
+            CV_LOG_DEBUG(NULL, "VIDEOIO/FFMPEG: seek index is loaded from " << cache_path);
+            return true;
+        }
+    }
+
+    const bool built = seek_index->build(ic, video_stream);
+
+    // rewind to the beginning of the stream
+    const int64_t start_time = ic->streams[video_stream]->start_time;
+    if (av_seek_frame(ic, video_stream, start_time != AV_NOPTS_VALUE_ ? start_time : 0, AVSEEK_FLAG_BACKWARD) < 0)
+    {
+        CV_LOG_ERROR(NULL, "VIDEOIO/FFMPEG: can't rewind the input after building of the seek index");
+        return false;
+    }
+
+    if (!built)
+    {
+        CV_LOG_WARNING(NULL, "VIDEOIO/FFMPEG: can't build the seek index: no timestamps or key frames in the video stream");
+        delete seek_index;
+        seek_index = 0;
+        return true;
+    }
+    CV_LOG_INFO(NULL, "VIDEOIO/FFMPEG: seek index: " << seek_index->frame_pts.size() << " frames, "
+                      << seek_index->key_pts.size() << " key frames");
+    if (!cache_path.empty() && !seek_index->save(cache_path, file_size, file_mtime))
+        CV_LOG_WARNING(NULL, "VIDEOIO/FFMPEG: can't write seek index to " << cache_path);
+    return true;
+}
+
+// Jumps to the key frame preceding the requested frame and decodes only the frames in between
+bool CvCapture_FFMPEG::seekWithIndex(int64_t _frame_number)
+{
+    const int64_t total = (int64_t)seek_index->frame_pts.size();
+    _frame_number = std::max(std::min(_frame_number, total), (int64_t)0);
+
+    // The frame preceding the requested one is decoded, so the next grabFrame() returns the requested one
+    const int64_t target = _frame_number - 1;
+    const int64_t start_pts = target >= 0 ? seek_index->keyFramePts(target) : seek_index->frame_pts[0];
+    if (av_seek_frame(ic, video_stream, start_pts, AVSEEK_FLAG_BACKWARD) < 0)
+        return false;
+    avcodec_flush_buffers(context);
+
+    frame_number = seek_index->frameNumber(start_pts);
+    if (target >= 0)
+    {
+        do
+        {
+            if (!grabFrame())
+                return false;
+        } while (seek_index->frameNumber(picture_pts) < target);
+    }
+    frame_number = _frame_number;
+    return true;
+}
+
 void CvCapture_FFMPEG::seek(int64_t _frame_number)
 {
     if (!rawMode) {
         CV_Assert(context);
+        if (seek_index && seekWithIndex(_frame_number))
+            return;
     }
     _frame_number = std::min(_frame_number, get_total_frames());
     int delta = !rawMode ? 16 : 0;
@@ -2021,6 +2453,15 @@ void CvCapture_FFMPEG::seek(int64_t _frame_number)
 
 void CvCapture_FFMPEG::seek(double sec)
 {
+    const AVStream* st = ic->streams[video_stream];
+    const double time_base = r2d(st->time_base);
+    if (seek_index && !rawMode && time_base > 0)
+    {
+        // exact mapping for variable frame rate streams
+        const int64_t pts = (st->start_time != AV_NOPTS_VALUE_ ? st->start_time : 0) + (int64_t)(sec / time_base + 0.5);
+        seek(seek_index->frameNumber(pts));
+        return;
+    }
     seek((int64_t)(sec * get_fps() + 0.5));
 }
 
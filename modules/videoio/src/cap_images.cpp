@@ -54,6 +54,14 @@
 #include "opencv2/core/utils/filesystem.hpp"
 #include "opencv2/videoio/utils.private.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
 #if 0
 #define CV_WARN(message)
 #else
@@ -62,22 +70,228 @@
 
 namespace cv {
 
+// Decoders of these formats read from memory, so imdecode() doesn't go through a temporary file
+static bool isMemoryDecodable(const std::string& filename)
+{
+    std::string::size_type pos = filename.rfind('.');
+    if (pos == std::string::npos)
+        return false;
+    std::string ext = filename.substr(pos + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) { return (char)tolower(c); });
+    static const char* const exts[] = {
+        "bmp", "dib", "jpeg", "jpg", "jpe", "png", "pbm", "pgm", "ppm", "pxm", "pnm", "pam", "tif", "tiff", "webp", "avif"
+    };
+    for (const char* e : exts)
+        if (ext == e)
+            return true;
+    return false;
+}
+
+// Decodes the image into 'dst', the buffer of 'dst' is reused if the size and type of the image match
+static bool readImage(const std::string& filename, bool from_memory, std::vector<uchar>& data, Mat& dst)
+{
+    if (from_memory)
+    {
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        if (f)
+        {
+            f.seekg(0, std::ios::end);
+            const std::streamoff size = f.tellg();
+            f.seekg(0, std::ios::beg);
+            if (size > 0)
+            {
+                data.resize((size_t)size);
+                f.read((char*)data.data(), size);
+                if (f && !imdecode(data, IMREAD_UNCHANGED, &dst).empty())
+                    return true;
+            }
+        }
+        dst.release();
+        return false;
+    }
+    dst = imread(filename, IMREAD_UNCHANGED);
+    return !dst.empty();
+}
+
+// Decodes frames of the sequence ahead in the worker threads.
+// Frames are returned in order, decoded buffers are reused once released.
+class ImageSequenceReadAhead
+{
+public:
+    ImageSequenceReadAhead(const std::string& pattern, unsigned first, unsigned length, bool from_memory,
+                           unsigned start, int num_threads);
+    ~ImageSequenceReadAhead();
+
+    // Returns false if the image can't be read
+    bool get(unsigned index, Mat& frame);
+    // Gives the buffer back for decoding of the next frames, 'frame' is released
+    void recycle(Mat& frame);
+
+private:
+    struct Slot
+    {
+        Slot() : has_data(false) {}
+        Mat frame;
+        bool has_data;
+        std::exception_ptr error;
+    };
+
+    void worker();
+    void recycleLocked(Mat& frame);
+
+    const std::string m_pattern;
+    const unsigned m_first;
+    const unsigned m_length;
+    const bool m_from_memory;
+    const size_t m_capacity;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond_ready;  // a frame is decoded
+    std::condition_variable m_cond_space;  // the window is moved or the reading is restarted
+    std::map<unsigned, Slot> m_ready;
+    std::vector<Mat> m_free;
+    unsigned m_next_read;   // the next frame to be taken by a worker
+    unsigned m_next_get;    // the first frame of the window
+    uint64_t m_generation;  // incremented on every restart, results of the previous ones are dropped
+    bool m_stop;
+
+    std::vector<std::thread> m_workers;
+};
+
+ImageSequenceReadAhead::ImageSequenceReadAhead(const std::string& pattern, unsigned first, unsigned length, bool from_memory,
+                                               unsigned start, int num_threads)
+    : m_pattern(pattern), m_first(first), m_length(length), m_from_memory(from_memory), m_capacity(2 * num_threads + 2),
+      m_next_read(start), m_next_get(start), m_generation(0), m_stop(false)
+{
+    CV_Assert(num_threads > 0);
+    for (int i = 0; i < num_threads; i++)
+        m_workers.emplace_back(&ImageSequenceReadAhead::worker, this);
+}
+
+ImageSequenceReadAhead::~ImageSequenceReadAhead()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond_space.notify_all();
+    for (auto& t : m_workers)
+        t.join();
+}
+
+void ImageSequenceReadAhead::recycleLocked(Mat& frame)
+{
+    if (!frame.empty() && m_free.size() < m_capacity)
+        m_free.push_back(frame);
+    frame.release();
+}
+
+void ImageSequenceReadAhead::recycle(Mat& frame)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    recycleLocked(frame);
+}
+
+void ImageSequenceReadAhead::worker()
+{
+    std::vector<uchar> data;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+        m_cond_space.wait(lock, [this]() {
+            return m_stop || (m_next_read < m_length && m_next_read < m_next_get + m_capacity);
+        });
+        if (m_stop)
+            break;
+        const unsigned index = m_next_read++;
+        const uint64_t generation = m_generation;
+        Slot slot;
+        while (!m_free.empty() && slot.frame.empty())
+        {
+            slot.frame = m_free.back();
+            m_free.pop_back();
+            // still referenced outside, leave it there
+            if (slot.frame.u && slot.frame.u->refcount > 1)
+                slot.frame.release();
+        }
+        lock.unlock();
+
+        try
+        {
+            const std::string filename = cv::format(m_pattern.c_str(), (int)(m_first + index));
+            slot.has_data = readImage(filename, m_from_memory, data, slot.frame);
+        }
+        catch (...)
+        {
+            slot.error = std::current_exception();
+        }
+
+        lock.lock();
+        if (generation == m_generation && index >= m_next_get)
+        {
+            m_ready[index] = slot;
+            m_cond_ready.notify_all();
+        }
+        else
+        {
+            recycleLocked(slot.frame);
+        }
+    }
+}
+
+bool ImageSequenceReadAhead::get(unsigned index, Mat& frame)
+{
+    CV_Assert(index < m_length);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::map<unsigned, Slot>::iterator end;
+    if (index < m_next_get || index >= m_next_read)
+    {
+        m_generation++;
+        end = m_ready.end();
+        m_next_read = index;
+    }
+    else
+    {
+        // Frames skipped by grab() without retrieve()
+        end = m_ready.lower_bound(index);
+    }
+    for (std::map<unsigned, Slot>::iterator it = m_ready.begin(); it != end; ++it)
+        recycleLocked(it->second.frame);
+    m_ready.erase(m_ready.begin(), end);
+    m_next_get = index;
+    m_cond_space.notify_all();
+
+    m_cond_ready.wait(lock, [&]() { return m_ready.count(index) != 0; });
+    Slot slot = m_ready[index];
+    m_ready.erase(index);
+    m_next_get = index + 1;
+    lock.unlock();
+    m_cond_space.notify_all();
+
+    if (slot.error)
+        std::rethrow_exception(slot.error);
+    frame = slot.frame;
+    return slot.has_data;
+}
+
 class CvCapture_Images: public IVideoCapture
 {
 public:
     void init()
     {
+        read_ahead.release();
         filename_pattern.clear();
         frame.release();
         currentframe = firstframe = 0;
         length = 0;
         grabbedInOpen = false;
+        decodeFromMemory = false;
     }
-    CvCapture_Images()
+    CvCapture_Images() : numThreads(0)
     {
         init();
     }
-    CvCapture_Images(const String& _filename)
+    CvCapture_Images(const String& _filename) : numThreads(0)
     {
         init();
         open(_filename);
@@ -97,6 +311,8 @@ public:
     bool open(const String&);
     void close();
 protected:
+    bool setNumThreads(int num_threads);
+
     std::string filename_pattern; // actually a printf-pattern
     unsigned currentframe;
     unsigned firstframe; // number of first frame
@@ -104,6 +320,13 @@ protected:
 
     Mat frame;
     bool grabbedInOpen;
+
+    bool decodeFromMemory; // decode into the buffer of the previous frame
+    std::vector<uchar> data;
+
+    // read-ahead decoding, enabled by CAP_PROP_N_THREADS
+    int numThreads; // 0 if disabled
+    Ptr<ImageSequenceReadAhead> read_ahead;
 };
 
 void CvCapture_Images::close()
@@ -133,11 +356,37 @@ bool CvCapture_Images::grabFrame()
         return !frame.empty();
     }
 
-    frame = imread(filename, IMREAD_UNCHANGED);
-    if( !frame.empty() )
+    bool res;
+    if (read_ahead && currentframe < length)
+    {
+        read_ahead->recycle(frame);
+        res = read_ahead->get(currentframe, frame);
+    }
+    else
+    {
+        res = readImage(filename, decodeFromMemory, data, frame);
+    }
+    if (res)
         currentframe++;
 
-    return !frame.empty();
+    return res;
+}
+
+bool CvCapture_Images::setNumThreads(int num_threads)
+{
+    if (num_threads < 0)
+        return false;
+    if (num_threads == 0)
+        num_threads = getNumberOfCPUs();
+    read_ahead.release();
+    numThreads = num_threads;
+    if (isOpened() && length > 1)
+    {
+        const unsigned start = currentframe + (grabbedInOpen ? 1 : 0);
+        read_ahead.reset(new ImageSequenceReadAhead(filename_pattern, firstframe, length, decodeFromMemory,
+                                                    std::min(start, length), numThreads));
+    }
+    return true;
 }
 
 bool CvCapture_Images::retrieveFrame(int, OutputArray out)
@@ -170,6 +419,8 @@ double CvCapture_Images::getProperty(int id) const
     case CV_CAP_PROP_FOURCC:
         CV_WARN("collections of images don't have 4-character codes");
         return 0;
+    case CAP_PROP_N_THREADS:
+        return numThreads > 0 ? (double)numThreads : 1.;
     }
     return 0;
 }
@@ -204,6 +455,8 @@ bool CvCapture_Images::setProperty(int id, double value)
         if (currentframe != 0)
             grabbedInOpen = false; // grabbed frame is not valid anymore
         return true;
+    case CAP_PROP_N_THREADS:
+        return setNumThreads(cvRound(value));
     }
     CV_WARN("unknown/unhandled property");
     return false;
@@ -350,6 +603,7 @@ bool CvCapture_Images::open(const std::string& _filename)
 
         firstframe = offset;
     }
+    decodeFromMemory = isMemoryDecodable(filename_pattern);
     // grab frame to enable properties retrieval
     bool grabRes = CvCapture_Images::grabFrame();
     grabbedInOpen = true;
@@ -465,6 +465,9 @@ Ptr<IVideoCapture> create_ueye_camera(int camera);
 Ptr<IVideoCapture> create_Aravis_capture( int index );
 
 Ptr<IVideoCapture> createMotionJpegCapture(const std::string& filename);
+
+//! Wraps the opened capture to decode up to 'frames' frames ahead on a background thread
+Ptr<IVideoCapture> createPrefetchingCapture(const Ptr<IVideoCapture>& cap, int frames, bool dropOldest);
 Ptr<IVideoWriter> createMotionJpegWriter(const std::string& filename, int fourcc,
                                          double fps, const Size& frameSize,
                                          const VideoWriterParameters& params);
@@ -42,9 +42,151 @@
 #include "precomp.hpp"
 #include "opencv2/videoio/container_avi.private.hpp"
 
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
 namespace cv
 {
 
+static const int MJPEG_DECODE_FLAGS = IMREAD_ANYDEPTH | IMREAD_COLOR | IMREAD_IGNORE_ORIENTATION;
+
+// Reads and decodes the frames following the requested one in background threads.
+// Chunks are read one at a time (the container stream is not thread-safe) and
+// decoded concurrently. Decoded frames wait in a bounded reorder buffer until
+// they are requested. A request for a frame outside of the read-ahead window
+// (e.g. after a seek) restarts the reading from that frame.
+class MotionJpegReadAhead
+{
+public:
+    MotionJpegReadAhead(const Ptr<AVIReadContainer>& container, frame_list& frames, int num_threads);
+    ~MotionJpegReadAhead();
+
+    // Returns false if the frame chunk is empty
+    bool get(size_t index, Mat& frame);
+
+private:
+    struct Slot
+    {
+        Slot() : has_data(false) {}
+        Mat frame;
+        bool has_data;
+        std::exception_ptr error;
+    };
+
+    void worker();
+
+    Ptr<AVIReadContainer> m_container;
+    frame_list& m_frames;
+    size_t m_capacity;
+
+    std::mutex m_io_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_cond_ready;  // a frame is decoded
+    std::condition_variable m_cond_space;  // the window is moved or the reading is restarted
+    std::map<size_t, Slot> m_ready;
+    size_t m_next_read;     // the next frame to be taken by a worker
+    size_t m_next_get;      // the first frame of the window
+    uint64_t m_generation;  // incremented on every restart, results of the previous ones are dropped
+    bool m_stop;
+
+    std::vector<std::thread> m_workers;
+};
+
+MotionJpegReadAhead::MotionJpegReadAhead(const Ptr<AVIReadContainer>& container, frame_list& frames, int num_threads)
+    : m_container(container), m_frames(frames), m_capacity(2 * num_threads + 2),
+      m_next_read(0), m_next_get(0), m_generation(0), m_stop(false)
+{
+    CV_Assert(num_threads > 0);
+    for (int i = 0; i < num_threads; i++)
+        m_workers.emplace_back(&MotionJpegReadAhead::worker, this);
+}
+
+MotionJpegReadAhead::~MotionJpegReadAhead()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond_space.notify_all();
+    for (auto& t : m_workers)
+        t.join();
+}
+
+void MotionJpegReadAhead::worker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+        m_cond_space.wait(lock, [this]() {
+            return m_stop || (m_next_read < m_frames.size() && m_next_read < m_next_get + m_capacity);
+        });
+        if (m_stop)
+            break;
+        const size_t index = m_next_read++;
+        const uint64_t generation = m_generation;
+        lock.unlock();
+
+        Slot slot;
+        try
+        {
+            std::vector<char> data;
+            {
+                std::lock_guard<std::mutex> io_lock(m_io_mutex);
+                data = m_container->readFrame(m_frames.begin() + index);
+            }
+            slot.has_data = !data.empty();
+            if (slot.has_data)
+                slot.frame = imdecode(data, MJPEG_DECODE_FLAGS);
+        }
+        catch (...)
+        {
+            slot.error = std::current_exception();
+        }
+
+        lock.lock();
+        if (generation == m_generation && index >= m_next_get)
+        {
+            m_ready[index] = slot;
+            m_cond_ready.notify_all();
+        }
+    }
+}
+
+bool MotionJpegReadAhead::get(size_t index, Mat& frame)
+{
+    CV_Assert(index < m_frames.size());
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (index < m_next_get || index >= m_next_read)
+    {
+        m_generation++;
+        m_ready.clear();
+        m_next_read = index;
+    }
+    else
+    {
+        // Frames skipped by grab() without retrieve()
+        m_ready.erase(m_ready.begin(), m_ready.lower_bound(index));
+    }
+    m_next_get = index;
+    m_cond_space.notify_all();
+
+    m_cond_ready.wait(lock, [&]() { return m_ready.count(index) != 0; });
+    Slot slot = m_ready[index];
+    m_ready.erase(index);
+    m_next_get = index + 1;
+    lock.unlock();
+    m_cond_space.notify_all();
+
+    if (slot.error)
+        std::rethrow_exception(slot.error);
+    if (slot.has_data)
+        frame = slot.frame;
+    return slot.has_data;
+}
+
 class MotionJpegCapture: public IVideoCapture
 {
 public:
@@ -62,6 +204,7 @@ public:
 protected:
 
     inline uint64_t getFramePos() const;
+    bool setNumThreads(int num_threads);
 
     Ptr<AVIReadContainer> m_avi_container;
     bool             m_is_first_frame;
@@ -76,8 +219,27 @@ protected:
     uint32_t         m_frame_width;
     uint32_t         m_frame_height;
     double           m_fps;
+
+    //read-ahead decoding, enabled by CAP_PROP_N_THREADS
+    int              m_num_threads; // 0 if disabled
+    Ptr<MotionJpegReadAhead> m_read_ahead;
+    size_t           m_current_index;
 };
 
+bool MotionJpegCapture::setNumThreads(int num_threads)
+{
+    if (num_threads < 0)
+        return false;
+    if (num_threads == 0)
+        num_threads = getNumberOfCPUs();
+    m_read_ahead.release();
+    m_num_threads = num_threads;
+    m_current_index = m_mjpeg_frames.size();
+    if (isOpened())
+        m_read_ahead.reset(new MotionJpegReadAhead(m_avi_container, m_mjpeg_frames, m_num_threads));
+    return true;
+}
+
 uint64_t MotionJpegCapture::getFramePos() const
 {
     if(m_is_first_frame)
@@ -106,6 +268,10 @@ bool MotionJpegCapture::setProperty(int property, double value)
             return true;
         }
     }
+    else if(property == CAP_PROP_N_THREADS)
+    {
+        return setNumThreads(cvRound(value));
+    }
 
     return false;
 }
@@ -132,6 +298,8 @@ double MotionJpegCapture::getProperty(int property) const
             return (double)m_mjpeg_frames.size();
         case CAP_PROP_FORMAT:
             return 0;
+        case CAP_PROP_N_THREADS:
+            return m_num_threads > 0 ? (double)m_num_threads : 1.;
         default:
             return 0;
     }
@@ -162,11 +330,27 @@ bool MotionJpegCapture::retrieveFrame(int, OutputArray output_frame)
 {
     if(m_frame_iterator != m_mjpeg_frames.end())
     {
+        if(m_read_ahead)
+        {
+            const size_t index = m_frame_iterator - m_mjpeg_frames.begin();
+            if(index != m_current_index)
+            {
+                Mat frame;
+                if(m_read_ahead->get(index, frame))
+                    m_current_frame = frame;
+                m_current_index = index;
+            }
+
+            m_current_frame.copyTo(output_frame);
+
+            return true;
+        }
+
         std::vector<char> data = m_avi_container->readFrame(m_frame_iterator);
 
         if(data.size())
         {
-            m_current_frame = imdecode(data, IMREAD_ANYDEPTH | IMREAD_COLOR | IMREAD_IGNORE_ORIENTATION);
+            m_current_frame = imdecode(data, MJPEG_DECODE_FLAGS);
         }
 
         m_current_frame.copyTo(output_frame);
@@ -183,6 +367,7 @@ MotionJpegCapture::~MotionJpegCapture()
 }
 
 MotionJpegCapture::MotionJpegCapture(const String& filename)
+    : m_num_threads(0), m_current_index(0)
 {
     m_avi_container = makePtr<AVIReadContainer>();
     m_avi_container->initStream(filename);
@@ -196,6 +381,7 @@ bool MotionJpegCapture::isOpened() const
 
 void MotionJpegCapture::close()
 {
+    m_read_ahead.release();
     m_avi_container->close();
     m_frame_iterator = m_mjpeg_frames.end();
 }
@@ -218,6 +404,9 @@ bool MotionJpegCapture::open(const String& filename)
         m_frame_width = m_avi_container->getWidth();
         m_frame_height = m_avi_container->getHeight();
         m_fps = m_avi_container->getFps();
+        m_current_index = m_mjpeg_frames.size();
+        if (m_num_threads > 0)
+            m_read_ahead.reset(new MotionJpegReadAhead(m_avi_container, m_mjpeg_frames, m_num_threads));
     }
 
     return isOpened();
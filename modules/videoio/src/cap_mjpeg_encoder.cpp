@@ -44,6 +44,7 @@
 
 #include <vector>
 #include <deque>
+#include <future>
 #include <iostream>
 #include <cstdlib>
 
@@ -238,6 +239,48 @@ private:
 };
 
 
+// Appends the entropy-coded words to the byte stream the same way as
+// BitStream::jput()/jflush(): a zero byte is stuffed after every 0xFF and
+// the last word is padded with 1-bits up to the byte boundary.
+static void putStuffedBits(std::vector<uchar>& out, const unsigned* data, int len, int last_bit_len)
+{
+    uchar v;
+    for( int k = 0; k < len - 1; k++ )
+    {
+        unsigned currval = data[k];
+        for( int shift = 24; shift >= 0; shift -= 8 )
+        {
+            v = (uchar)(currval >> shift);
+            out.push_back(v);
+            if( v == 255 )
+                out.push_back(0);
+        }
+    }
+
+    int bitIdx = 32 - last_bit_len;
+    unsigned currval = data[len - 1] | ((1 << bitIdx) - 1);
+    while( bitIdx < 32 )
+    {
+        v = (uchar)(currval >> 24);
+        out.push_back(v);
+        if( v == 255 )
+            out.push_back(0);
+        currval <<= 8;
+        bitIdx += 8;
+    }
+}
+
+static inline void putByte(std::vector<uchar>& out, int val)
+{
+    out.push_back((uchar)val);
+}
+
+static inline void jputShort(std::vector<uchar>& out, int val)
+{
+    out.push_back((uchar)(val >> 8));
+    out.push_back((uchar)val);
+}
+
 class mjpeg_buffer_keeper
 {
 public:
@@ -415,6 +458,15 @@ public:
         if( !container.isOpenedStream() )
             return;
 
+        try
+        {
+            writePendingFrame();
+        }
+        catch (const cv::Exception& e)
+        {
+            CV_LOG_ERROR(NULL, "MJPEG: failed to encode the last frame: " << e.what());
+        }
+
         if( !container.isEmptyFrameOffset() && !rawstream )
         {
             container.endWriteChunk(); // end LIST 'movi'
@@ -456,7 +508,6 @@ public:
     void write(InputArray _img) CV_OVERRIDE
     {
         Mat img = _img.getMat();
-        size_t chunkPointer = container.getStreamPos();
         int input_channels = img.channels();
         int colorspace = -1;
         int imgWidth = img.cols;
@@ -489,12 +540,35 @@ public:
         else
             CV_Error(cv::Error::StsBadArg, "Invalid combination of specified video colorspace and the input image colorspace");
 
+        // The frame is encoded in background while the caller prepares the next one,
+        // the encoded data is written to the container on the next write() or close()
+        writePendingFrame();
+
+        Mat frame = img.clone();
+        const double frame_quality = quality, frame_nstripes = nstripes;
+        pending_frame = std::async(std::launch::async, [this, frame, colorspace, input_channels, frame_quality, frame_nstripes]() {
+            encodeFrame(frame.data, (int)frame.step, colorspace, input_channels, frame_quality, frame_nstripes, frame_data);
+        });
+    }
+
+    void writePendingFrame()
+    {
+        if( !pending_frame.valid() )
+            return;
+        pending_frame.get();
+
+        size_t chunkPointer = container.getStreamPos();
         if( !rawstream ) {
             int avi_index = container.getAVIIndex(0, dc);
             container.startWriteChunk(avi_index);
         }
 
-        writeFrameData(img.data, (int)img.step, colorspace, input_channels);
+        container.putStreamBytes(frame_data.data(), (int)frame_data.size());
+
+        size_t pos = container.getStreamPos();
+        size_t pos1 = (pos + 3) & ~3;
+        for( ; pos < pos1; pos++ )
+            container.putStreamByte(0);
 
         if( !rawstream )
         {
@@ -512,6 +586,13 @@ public:
             return quality;
         if( propId == VIDEOWRITER_PROP_FRAMEBYTES )
         {
+            if( pending_frame.valid() )
+            {
+                // Size of the chunk the frame will be written to, see writePendingFrame()
+                pending_frame.wait();
+                size_t pos = container.getStreamPos() + 8;
+                return (double)(((pos + frame_data.size() + 3) & ~(size_t)3) - pos);
+            }
             bool isEmpty = container.isEmptyFrameSize();
             return isEmpty ? 0. : container.atFrameSize(container.countFrameSize() - 1);
         }
@@ -537,14 +618,19 @@ public:
         return false;
     }
 
-    void writeFrameData( const uchar* data, int step, int colorspace, int input_channels );
+    void encodeFrame( const uchar* data, int step, int colorspace, int input_channels,
+                      double frame_quality, double frame_nstripes, std::vector<uchar>& out );
 
 protected:
     double quality;
     bool rawstream;
     mjpeg_buffer_keeper buffers_list;
+    std::vector<std::vector<uchar> > stripes_data;
     double nstripes;
 
+    std::future<void> pending_frame;
+    std::vector<uchar> frame_data;
+
     AVIWriteContainer container;
 };
 
@@ -1157,9 +1243,11 @@ public:
         short (&_fdct_qtab)[2][64],
         uchar* _cat_table,
         mjpeg_buffer_keeper& _buffer_list,
+        std::vector<std::vector<uchar> >& _stripes_data,
         double nstripes
     ) :
         m_buffer_list(_buffer_list),
+        m_stripes_data(_stripes_data),
         height(_height),
         width(_width),
         step(_step),
@@ -1182,7 +1270,7 @@ public:
             if(height*width > min_pixels_count)
             {
                 const int default_stripes_count = 4;
-                stripes_count = default_stripes_count;
+                stripes_count = std::max(default_stripes_count, cv::getNumThreads());
             }
         }
         else
@@ -1197,6 +1285,26 @@ public:
 
         stripes_count = std::min(stripes_count, max_stripes);
 
+        // The stripes are separated by restart markers, so they are coded
+        // independently and byte-aligned: no DC prediction from the previous
+        // stripe and no bit shifting to glue them. The restart interval is
+        // counted in MCUs, so all the stripes but the last one have the same height.
+        restart_interval = 0;
+        rows_per_stripe = 0;
+        if(stripes_count > 1)
+        {
+            const int max_restart_interval = 65535;
+            int mcus_per_row = (width - 1)/y_step + 1;
+            rows_per_stripe = std::min((max_stripes - 1)/stripes_count + 1, max_restart_interval/mcus_per_row);
+            if(rows_per_stripe > 0)
+            {
+                stripes_count = (max_stripes - 1)/rows_per_stripe + 1;
+                restart_interval = rows_per_stripe*mcus_per_row;
+                if((int)m_stripes_data.size() < stripes_count)
+                    m_stripes_data.resize(stripes_count);
+            }
+        }
+
         m_buffer_list.allocate_buffers(stripes_count, (height*width*2)/stripes_count);
     }
 
@@ -1223,7 +1331,7 @@ public:
         int num_steps = (height - 1)/y_step + 1;
 
         //if this is not first stripe we need to calculate dc_pred from previous step
-        if(range.start > 0)
+        if(range.start > 0 && restart_interval == 0)
         {
             y = y_step*int(num_steps*range.start/stripes_count - 1);
             data = init_data + y*step;
@@ -1265,6 +1373,13 @@ public:
             int y_min = y_step*int(num_steps*k/stripes_count);
             int y_max = y_step*int(num_steps*(k+1)/stripes_count);
 
+            if(restart_interval > 0)
+            {
+                y_min = y_step*rows_per_stripe*k;
+                y_max = y_step*rows_per_stripe*(k+1);
+                dc_pred[0] = dc_pred[1] = dc_pred[2] = 0;
+            }
+
             if(k == stripes_count - 1)
             {
                 y_max = height;
@@ -1346,6 +1461,19 @@ public:
                     }
                 }
             }
+
+            if(restart_interval > 0)
+            {
+                std::vector<uchar>& out = m_stripes_data[k];
+                out.clear();
+                output_buffer.finish();
+                putStuffedBits(out, output_buffer.get_data(), output_buffer.get_len(), 32 - output_buffer.get_bits_free());
+                if(k < stripes_count - 1)
+                {
+                    out.push_back(0xFF);
+                    out.push_back((uchar)(0xD0 + (k & 7))); // RSTn marker
+                }
+            }
         }
     }
 
@@ -1359,7 +1487,13 @@ public:
         return stripes_count;
     }
 
+    int getRestartInterval()
+    {
+        return restart_interval;
+    }
+
     mjpeg_buffer_keeper& m_buffer_list;
+    std::vector<std::vector<uchar> >& m_stripes_data;
 private:
 
     MjpegEncoder& operator=( const MjpegEncoder & ) { return *this; }
@@ -1376,24 +1510,35 @@ private:
     const short (&fdct_qtab)[2][64];
     const uchar* cat_table;
     int stripes_count;
+    int restart_interval;
+    int rows_per_stripe;
 };
 
-void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspace, int input_channels )
+namespace {
+const int CAT_TAB_SIZE = 4096;
+
+struct CatTable
 {
-    //double total_cvt = 0, total_dct = 0;
-    static bool init_cat_table = false;
-    const int CAT_TAB_SIZE = 4096;
-    static uchar cat_table[CAT_TAB_SIZE*2+1];
-    if( !init_cat_table )
+    CatTable()
     {
         for( int i = -CAT_TAB_SIZE; i <= CAT_TAB_SIZE; i++ )
         {
             Cv32suf a;
             a.f = (float)i;
-            cat_table[i+CAT_TAB_SIZE] = ((a.i >> 23) & 255) - (126 & (i ? -1 : 0));
+            data[i+CAT_TAB_SIZE] = ((a.i >> 23) & 255) - (126 & (i ? -1 : 0));
         }
-        init_cat_table = true;
     }
+    uchar data[CAT_TAB_SIZE*2+1];
+};
+}
+
+void MotionJpegWriter::encodeFrame( const uchar* data, int step, int colorspace, int input_channels,
+                                    double frame_quality, double frame_nstripes, std::vector<uchar>& out )
+{
+    //double total_cvt = 0, total_dct = 0;
+    // NB: frames may be encoded in different threads
+    static const CatTable cat_table_holder;
+    uchar* cat_table = const_cast<uchar*>(cat_table_holder.data);
 
     //double total_dct = 0, total_cvt = 0;
     int width = container.getWidth();
@@ -1418,7 +1563,7 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
     short  buffer[4096];
     int*   hbuffer = (int*)buffer;
     int  luma_count = x_scale*y_scale;
-    double _quality = quality*0.01*max_quality;
+    double _quality = frame_quality*0.01*max_quality;
 
     if( _quality < 1. ) _quality = 1.;
     if( _quality > max_quality ) _quality = max_quality;
@@ -1426,7 +1571,7 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
     double inv_quality = 1./_quality;
 
     // Encode header
-    container.putStreamBytes( (const uchar*)jpegHeader, sizeof(jpegHeader) - 1 );
+    out.assign(jpegHeader, jpegHeader + sizeof(jpegHeader) - 1);
 
     // Encode quantization tables
     for( i = 0; i < (channels > 1 ? 2 : 1); i++ )
@@ -1434,9 +1579,9 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
         const uchar* qtable = i == 0 ? jpegTableK1_T : jpegTableK2_T;
         int chroma_scale = i > 0 ? luma_count : 1;
 
-        container.jputStreamShort( 0xffdb );   // DQT marker
-        container.jputStreamShort( 2 + 65*1 ); // put single qtable
-        container.putStreamByte( 0*16 + i );   // 8-bit table
+        jputShort( out, 0xffdb );   // DQT marker
+        jputShort( out, 2 + 65*1 ); // put single qtable
+        putByte( out, 0*16 + i );   // 8-bit table
 
         // put coefficients
         for( j = 0; j < 64; j++ )
@@ -1449,7 +1594,7 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
                 qval = 255;
             fdct_qtab[i][idx] = (short)(cvRound((1 << (postshift + 11)))/
                                 (qval*chroma_scale*idct_prescale[idx]));
-            container.putStreamByte( qval );
+            putByte( out, qval );
         }
     }
 
@@ -1462,10 +1607,10 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
         int idx = i >= 2;
         int tableSize = 16 + (is_ac_tab ? 162 : 12);
 
-        container.jputStreamShort( 0xFFC4 );      // DHT marker
-        container.jputStreamShort( 3 + tableSize ); // define one huffman table
-        container.putStreamByte( is_ac_tab*16 + idx ); // put DC/AC flag and table index
-        container.putStreamBytes( htable, tableSize ); // put table
+        jputShort( out, 0xFFC4 );      // DHT marker
+        jputShort( out, 3 + tableSize ); // define one huffman table
+        putByte( out, is_ac_tab*16 + idx ); // put DC/AC flag and table index
+        out.insert(out.end(), htable, htable + tableSize); // put table
 
         createEncodeHuffmanTable(createSourceHuffmanTable( htable, hbuffer, 16, 9 ),
                                  is_ac_tab ? huff_ac_tab[idx] : huff_dc_tab[idx],
@@ -1473,64 +1618,69 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
     }
 
     // put frame header
-    container.jputStreamShort( 0xFFC0 );          // SOF0 marker
-    container.jputStreamShort( 8 + 3*channels );  // length of frame header
-    container.putStreamByte( 8 );               // sample precision
-    container.jputStreamShort( height );
-    container.jputStreamShort( width );
-    container.putStreamByte( channels );        // number of components
+    jputShort( out, 0xFFC0 );          // SOF0 marker
+    jputShort( out, 8 + 3*channels );  // length of frame header
+    putByte( out, 8 );               // sample precision
+    jputShort( out, height );
+    jputShort( out, width );
+    putByte( out, channels );        // number of components
 
     for( i = 0; i < channels; i++ )
     {
-        container.putStreamByte( i + 1 );  // (i+1)-th component id (Y,U or V)
+        putByte( out, i + 1 );  // (i+1)-th component id (Y,U or V)
         if( i == 0 )
-            container.putStreamByte(x_scale*16 + y_scale); // chroma scale factors
+            putByte( out, x_scale*16 + y_scale ); // chroma scale factors
         else
-            container.putStreamByte(1*16 + 1);
-        container.putStreamByte( i > 0 ); // quantization table idx
+            putByte( out, 1*16 + 1 );
+        putByte( out, i > 0 ); // quantization table idx
+    }
+
+    buffers_list.reset();
+
+    MjpegEncoder parallel_encoder(height, width, step, data, input_channels, channels, colorspace, huff_dc_tab, huff_ac_tab, fdct_qtab, cat_table, buffers_list, stripes_data, frame_nstripes);
+
+    int restart_interval = parallel_encoder.getRestartInterval();
+    if( restart_interval > 0 )
+    {
+        jputShort( out, 0xFFDD );          // DRI marker
+        jputShort( out, 4 );               // length of restart interval segment
+        jputShort( out, restart_interval );
     }
 
     // put scan header
-    container.jputStreamShort( 0xFFDA );          // SOS marker
-    container.jputStreamShort( 6 + 2*channels );  // length of scan header
-    container.putStreamByte( channels );          // number of components in the scan
+    jputShort( out, 0xFFDA );          // SOS marker
+    jputShort( out, 6 + 2*channels );  // length of scan header
+    putByte( out, channels );          // number of components in the scan
 
     for( i = 0; i < channels; i++ )
     {
-        container.putStreamByte( i+1 );             // component id
-        container.putStreamByte( (i>0)*16 + (i>0) );// selection of DC & AC tables
+        putByte( out, i+1 );             // component id
+        putByte( out, (i>0)*16 + (i>0) );// selection of DC & AC tables
     }
 
-    container.jputStreamShort(0*256 + 63); // start and end of spectral selection - for
+    jputShort(out, 0*256 + 63); // start and end of spectral selection - for
     // sequential DCT start is 0 and end is 63
 
-    container.putStreamByte( 0 );  // successive approximation bit position
+    putByte( out, 0 );  // successive approximation bit position
     // high & low - (0,0) for sequential DCT
 
-    buffers_list.reset();
-
-    MjpegEncoder parallel_encoder(height, width, step, data, input_channels, channels, colorspace, huff_dc_tab, huff_ac_tab, fdct_qtab, cat_table, buffers_list, nstripes);
-
     cv::parallel_for_(parallel_encoder.getRange(), parallel_encoder, parallel_encoder.getNStripes());
 
-    //std::vector<unsigned>& v = parallel_encoder.m_buffer_list.get_data();
-    unsigned* v = buffers_list.get_data();
-    unsigned last_data_elem = buffers_list.get_data_size() - 1;
-
-    for(unsigned k = 0; k < last_data_elem; ++k)
+    if( restart_interval > 0 )
     {
-        container.jputStream(v[k]);
+        for( int k = 0; k < (int)parallel_encoder.getNStripes(); k++ )
+            out.insert(out.end(), stripes_data[k].begin(), stripes_data[k].end());
     }
-    container.jflushStream(v[last_data_elem], 32 - buffers_list.get_last_bit_len());
-    container.jputStreamShort( 0xFFD9 ); // EOI marker
+    else
+    {
+        //std::vector<unsigned>& v = parallel_encoder.m_buffer_list.get_data();
+        unsigned* v = buffers_list.get_data();
+        putStuffedBits(out, v, buffers_list.get_data_size(), buffers_list.get_last_bit_len());
+    }
+    jputShort( out, 0xFFD9 ); // EOI marker
     /*printf("total dct = %.1fms, total cvt = %.1fms\n",
      total_dct*1000./cv::getTickFrequency(),
      total_cvt*1000./cv::getTickFrequency());*/
-
-    size_t pos = container.getStreamPos();
-    size_t pos1 = (pos + 3) & ~3;
-    for( ; pos < pos1; pos++ )
-        container.putStreamByte(0);
 }
 
 }
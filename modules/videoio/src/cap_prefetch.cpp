@@ -0,0 +1,281 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace cv {
+
+namespace {
+
+// Runs grabFrame() / retrieveFrame() of any backend on a background thread,
+// so decoding of the next frames overlaps with processing of the current one.
+// Only the main video channel (0) is prefetched.
+class PrefetchingCapture CV_FINAL : public IVideoCapture
+{
+public:
+    PrefetchingCapture(const Ptr<IVideoCapture>& cap, int capacity, bool dropOldest)
+        : m_cap(cap), m_capacity((size_t)capacity), m_drop_oldest(dropOldest),
+          m_stop(false), m_eof(false), m_dropped(0), m_delivered(0), m_latency_sum(0)
+    {
+        CV_Assert(m_cap && capacity > 0);
+        m_current.pos_frames = m_cap->getProperty(CAP_PROP_POS_FRAMES);
+        m_current.pos_msec = m_cap->getProperty(CAP_PROP_POS_MSEC);
+        startWorker();
+    }
+
+    ~PrefetchingCapture() CV_OVERRIDE
+    {
+        stopWorker(true);
+    }
+
+    bool grabFrame() CV_OVERRIDE
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        recycle(m_current.image);
+        m_has_current = false;
+        m_cond_frame.wait(lock, [this]() { return !m_queue.empty() || m_eof; });
+        if (m_queue.empty())
+        {
+            if (m_error)
+            {
+                std::exception_ptr error = m_error;
+                m_error = std::exception_ptr();
+                std::rethrow_exception(error);
+            }
+            return false;
+        }
+        m_current = m_queue.front();
+        m_queue.pop_front();
+        m_has_current = true;
+        m_latency_sum += getTickCount() - m_current.tick;
+        m_delivered++;
+        m_cond_space.notify_one();
+        return true;
+    }
+
+    bool retrieveFrame(int channel, OutputArray image) CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (channel != 0)
+        {
+            CV_LOG_WARNING(NULL, "VIDEOIO: prefetching capture provides the video channel (0) only, requested: " << channel);
+            return false;
+        }
+        if (!m_has_current)
+            return false;
+        // Share the buffer with the caller, it is recycled once the caller releases it
+        if (image.kind() == _InputArray::MAT && !image.fixedType() && !image.fixedSize())
+            image.getMatRef() = m_current.image;
+        else
+            m_current.image.copyTo(image);
+        return true;
+    }
+
+    double getProperty(int propId) const CV_OVERRIDE
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            switch (propId)
+            {
+            case CAP_PROP_PREFETCH_FRAMES:
+                return (double)m_capacity;
+            case CAP_PROP_PREFETCH_DROP_OLDEST:
+                return m_drop_oldest ? 1 : 0;
+            case CAP_PROP_PREFETCH_DROPPED_FRAMES:
+                return (double)m_dropped;
+            case CAP_PROP_PREFETCH_LATENCY_MSEC:
+                return m_delivered ? (double)m_latency_sum / m_delivered * 1000. / getTickFrequency() : 0.;
+            // the backend is ahead, report the position of the delivered frame
+            case CAP_PROP_POS_FRAMES:
+                return m_current.pos_frames;
+            case CAP_PROP_POS_MSEC:
+                return m_current.pos_msec;
+            default:
+                break;
+            }
+        }
+        std::lock_guard<std::mutex> lock(m_cap_mutex);
+        return m_cap->getProperty(propId);
+    }
+
+    bool setProperty(int propId, double value) CV_OVERRIDE
+    {
+        switch (propId)
+        {
+        case CAP_PROP_PREFETCH_FRAMES:
+        case CAP_PROP_PREFETCH_DROP_OLDEST:
+        case CAP_PROP_PREFETCH_DROPPED_FRAMES:
+        case CAP_PROP_PREFETCH_LATENCY_MSEC:
+            return false;
+        default:
+            break;
+        }
+        // Prefetched frames are dropped on seeking only, other properties apply with the delay of the queue
+        const bool seek = propId == CAP_PROP_POS_FRAMES || propId == CAP_PROP_POS_MSEC || propId == CAP_PROP_POS_AVI_RATIO;
+        stopWorker(seek);
+        const bool ret = m_cap->setProperty(propId, value);
+        if (seek)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_current.pos_frames = m_cap->getProperty(CAP_PROP_POS_FRAMES);
+            m_current.pos_msec = m_cap->getProperty(CAP_PROP_POS_MSEC);
+        }
+        startWorker();
+        return ret;
+    }
+
+    bool isOpened() const CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(m_cap_mutex);
+        return m_cap->isOpened();
+    }
+
+    int getCaptureDomain() CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(m_cap_mutex);
+        return m_cap->getCaptureDomain();
+    }
+
+private:
+    struct Frame
+    {
+        Mat image;
+        int64 tick = 0;  // when the frame became available
+        double pos_frames = 0;
+        double pos_msec = 0;
+    };
+
+    void startWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = false;
+            m_eof = false;
+        }
+        m_worker = std::thread(&PrefetchingCapture::run, this);
+    }
+
+    void stopWorker(bool flush)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cond_space.notify_all();
+        if (m_worker.joinable())
+            m_worker.join();
+        if (flush)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (Frame& f : m_queue)
+                recycle(f.image);
+            m_queue.clear();
+            m_error = std::exception_ptr();
+        }
+    }
+
+    // Must be called under m_mutex
+    void recycle(Mat& image)
+    {
+        if (!image.empty())
+            m_free.push_back(image);
+        image.release();
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            Frame frame;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_drop_oldest)
+                    m_cond_space.wait(lock, [this]() { return m_stop || m_queue.size() < m_capacity; });
+                if (m_stop)
+                    return;
+                while (!m_free.empty() && frame.image.empty())
+                {
+                    frame.image = m_free.back();
+                    m_free.pop_back();
+                    // still referenced by the caller, leave it there
+                    if (frame.image.u && frame.image.u->refcount > 1)
+                        frame.image.release();
+                }
+            }
+
+            bool ok = false;
+            std::exception_ptr error;
+            try
+            {
+                std::lock_guard<std::mutex> lock(m_cap_mutex);
+                ok = m_cap->grabFrame() && m_cap->retrieveFrame(0, frame.image) && !frame.image.empty();
+                if (ok)
+                {
+                    frame.pos_frames = m_cap->getProperty(CAP_PROP_POS_FRAMES);
+                    frame.pos_msec = m_cap->getProperty(CAP_PROP_POS_MSEC);
+                }
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            frame.tick = getTickCount();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!ok)
+            {
+                recycle(frame.image);
+                m_error = error;
+                m_eof = true;
+                m_cond_frame.notify_all();
+                return;
+            }
+            if (m_queue.size() >= m_capacity)
+            {
+                recycle(m_queue.front().image);
+                m_queue.pop_front();
+                m_dropped++;
+            }
+            m_queue.push_back(frame);
+            m_cond_frame.notify_one();
+        }
+    }
+
+    Ptr<IVideoCapture> m_cap;
+    mutable std::mutex m_cap_mutex;  // backend calls
+    const size_t m_capacity;
+    const bool m_drop_oldest;
+
+    mutable std::mutex m_mutex;  // everything below
+    std::condition_variable m_cond_frame;
+    std::condition_variable m_cond_space;
+    std::thread m_worker;
+    bool m_stop;
+    bool m_eof;
+    std::exception_ptr m_error;
+    std::deque<Frame> m_queue;
+    std::vector<Mat> m_free;
+    Frame m_current;
+    bool m_has_current = false;
+
+    // statistics
+    int64 m_dropped;
+    int64 m_delivered;
+    int64 m_latency_sum;  // ticks
+};
+
+} // namespace
+
+Ptr<IVideoCapture> createPrefetchingCapture(const Ptr<IVideoCapture>& cap, int frames, bool dropOldest)
+{
+    return makePtr<PrefetchingCapture>(cap, frames, dropOldest);
+}
+
+} // namespace cv
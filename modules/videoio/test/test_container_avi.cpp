@@ -85,4 +85,115 @@ TEST(videoio_builtin, read_write_avi)
     remove(filename.c_str());
 }
 
+TEST(videoio_builtin, mjpeg_read_ahead)
+{
+    const String filename = cv::tempfile(".avi");
+    const int count = 40;
+    const Size sz(320, 240);
+    {
+        VideoWriter writer(filename, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, sz);
+        ASSERT_TRUE(writer.isOpened());
+        Mat frame(sz, CV_8UC3);
+        for (int i = 0; i < count; i++)
+        {
+            generateFrame(i, count, frame);
+            writer << frame;
+        }
+    }
+
+    std::vector<Mat> ref;
+    {
+        VideoCapture cap(filename, CAP_OPENCV_MJPEG);
+        ASSERT_TRUE(cap.isOpened());
+        EXPECT_EQ(1, cap.get(CAP_PROP_N_THREADS));
+        Mat frame;
+        while (cap.read(frame))
+            ref.push_back(frame.clone());
+        ASSERT_EQ(count, (int)ref.size());
+    }
+
+    VideoCapture cap(filename, CAP_OPENCV_MJPEG, { CAP_PROP_N_THREADS, 3 });
+    ASSERT_TRUE(cap.isOpened());
+    EXPECT_EQ(3, cap.get(CAP_PROP_N_THREADS));
+    Mat frame;
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_TRUE(cap.read(frame));
+        EXPECT_EQ(0, cvtest::norm(ref[i], frame, NORM_INF)) << "frame " << i;
+    }
+
+    // grab() without retrieve() skips frames inside the read-ahead window
+    ASSERT_TRUE(cap.grab());
+    ASSERT_TRUE(cap.grab());
+    ASSERT_TRUE(cap.read(frame));
+    EXPECT_EQ(0, cvtest::norm(ref[22], frame, NORM_INF));
+
+    // seeks backward and forward
+    const int positions[] = { 5, 35, 0, 39 };
+    for (int pos : positions)
+    {
+        ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, pos));
+        EXPECT_EQ(pos, cap.get(CAP_PROP_POS_FRAMES));
+        for (int i = pos; i < std::min(pos + 3, count); i++)
+        {
+            ASSERT_TRUE(cap.read(frame));
+            EXPECT_EQ(0, cvtest::norm(ref[i], frame, NORM_INF)) << "frame " << i << " after seek to " << pos;
+        }
+    }
+    EXPECT_FALSE(cap.read(frame));
+
+    cap.release();
+    remove(filename.c_str());
+}
+
+TEST(videoio_builtin, mjpeg_writer_stripes)
+{
+    const int count = 5;
+    const Size sz(640, 480);
+    std::vector<Mat> frames(count);
+    for (int i = 0; i < count; i++)
+    {
+        frames[i].create(sz, CV_8UC3);
+        generateFrame(i, count, frames[i]);
+    }
+
+    // Stripes are separated by restart markers, the image data must stay the same
+    std::vector<Mat> decoded[2];
+    const double nstripes[2] = { 1, 7 };
+    for (int k = 0; k < 2; k++)
+    {
+        const String filename = cv::tempfile(".avi");
+        std::vector<double> frame_bytes;
+        {
+            VideoWriter writer(filename, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, sz);
+            ASSERT_TRUE(writer.isOpened());
+            ASSERT_TRUE(writer.set(VIDEOWRITER_PROP_NSTRIPES, nstripes[k]));
+            for (int i = 0; i < count; i++)
+            {
+                writer << frames[i];
+                frame_bytes.push_back(writer.get(VIDEOWRITER_PROP_FRAMEBYTES));
+            }
+        }
+
+        AVIReadContainer in;
+        in.initStream(filename);
+        frame_list index;
+        ASSERT_TRUE(in.parseRiff(index));
+        ASSERT_EQ((size_t)count, index.size());
+        for (int i = 0; i < count; i++)
+        {
+            EXPECT_EQ(frame_bytes[i], (double)index[i].second) << "frame " << i;
+            std::vector<char> data = in.readFrame(index.begin() + i);
+            decoded[k].push_back(imdecode(data, IMREAD_COLOR));
+            ASSERT_FALSE(decoded[k].back().empty());
+        }
+        remove(filename.c_str());
+    }
+    for (int i = 0; i < count; i++)
+    {
+        EXPECT_EQ(0, cvtest::norm(decoded[0][i], decoded[1][i], NORM_INF)) << "frame " << i;
+        EXPECT_LT(cvtest::norm(frames[i], decoded[1][i], NORM_L1) / frames[i].total(), 10.);
+    }
+}
+
 }} // opencv_test::<anonymous>::
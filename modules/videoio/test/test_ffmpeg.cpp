@@ -906,4 +906,100 @@ const FourCC_Ext_Color_Support sixteen_bit_modes[] =
 
 INSTANTIATE_TEST_CASE_P(/**/, videoio_ffmpeg_16bit, testing::ValuesIn(sixteen_bit_modes));
 
+typedef testing::TestWithParam<Size> videoio_ffmpeg_yuv;
+
+// BGR frames (converted by the backend) must match the native YUV 4:2:0 frames converted by cvtColor
+TEST_P(videoio_ffmpeg_yuv, native_planes)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    const Size sz = GetParam();  // width is not a multiple of 16 for the buffered conversion path
+    const string filename = tempfile(".avi");
+    const int numFrames = 5;
+    {
+        VideoWriter writer(filename, CAP_FFMPEG, fourccFromString("I420"), 25, sz);
+        ASSERT_TRUE(writer.isOpened());
+        Mat img(sz, CV_8UC3, Scalar::all(0));
+        for (int i = 0; i < numFrames; i++)
+        {
+            circle(img, Point(sz.width / 2, sz.height / 2), 10 * (i + 1), Scalar(50 * i, 255 - 40 * i, 128), -1);
+            writer << img;
+        }
+    }
+
+    VideoCapture capBGR(filename, CAP_FFMPEG);
+    VideoCapture capYUV(filename, CAP_FFMPEG, {CAP_PROP_CONVERT_RGB, false});
+    ASSERT_TRUE(capBGR.isOpened());
+    ASSERT_TRUE(capYUV.isOpened());
+    for (int i = 0; i < numFrames; i++)
+    {
+        Mat bgr, yuv, yuv2bgr;
+        ASSERT_TRUE(capBGR.read(bgr));
+        ASSERT_TRUE(capYUV.read(yuv));
+        ASSERT_EQ(CV_8UC3, bgr.type());
+        ASSERT_EQ(sz, bgr.size());
+        ASSERT_EQ(CV_8UC1, yuv.type());
+        ASSERT_EQ(Size(sz.width, sz.height * 3 / 2), yuv.size());
+        cvtColor(yuv, yuv2bgr, COLOR_YUV2BGR_I420);
+        EXPECT_GE(cvtest::PSNR(bgr, yuv2bgr), 35.0) << "frame " << i;
+    }
+    remove(filename.c_str());
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, videoio_ffmpeg_yuv, testing::Values(Size(320, 240), Size(328, 246)));
+
+TEST(videoio_ffmpeg, seek_index)
+{
+    if (!videoio_registry::hasBackend(CAP_FFMPEG))
+        throw SkipTestException("FFmpeg backend was not found");
+
+    const string filename = tempfile(".avi");
+    const Size sz(160, 120);
+    const int numFrames = 75;
+    {
+        VideoWriter writer(filename, CAP_FFMPEG, fourccFromString("mp4v"), 25, sz);
+        ASSERT_TRUE(writer.isOpened());
+        Mat img(sz, CV_8UC3);
+        for (int i = 0; i < numFrames; i++)
+        {
+            img.setTo(Scalar::all(0));
+            putText(img, cv::format("%d", i), Point(20, 80), FONT_HERSHEY_SIMPLEX, 2, Scalar(255, 255, 255), 3);
+            writer << img;
+        }
+    }
+
+    std::vector<Mat> frames;
+    {
+        VideoCapture cap(filename, CAP_FFMPEG);
+        ASSERT_TRUE(cap.isOpened());
+        EXPECT_EQ(0, cap.get(CAP_PROP_SEEK_INDEX));
+        Mat frame;
+        while (cap.read(frame))
+            frames.push_back(frame.clone());
+    }
+    ASSERT_EQ(numFrames, (int)frames.size());
+
+    VideoCapture cap(filename, CAP_FFMPEG, {CAP_PROP_SEEK_INDEX, 1});
+    ASSERT_TRUE(cap.isOpened());
+    ASSERT_EQ(1, cap.get(CAP_PROP_SEEK_INDEX));
+    EXPECT_EQ(numFrames, (int)cap.get(CAP_PROP_FRAME_COUNT));
+    const int positions[] = { 40, 3, 74, 0, 12, 1, 60, 59, 13 };
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+    {
+        const int pos = positions[i];
+        ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, pos));
+        EXPECT_EQ(pos, (int)cap.get(CAP_PROP_POS_FRAMES));
+        Mat frame;
+        ASSERT_TRUE(cap.read(frame)) << "pos=" << pos;
+        EXPECT_EQ(0, cvtest::norm(frames[pos], frame, NORM_INF)) << "pos=" << pos;
+        EXPECT_EQ(pos + 1, (int)cap.get(CAP_PROP_POS_FRAMES));
+    }
+    ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, numFrames));
+    Mat frame;
+    EXPECT_FALSE(cap.read(frame));
+    cap.release();
+    remove(filename.c_str());
+}
+
 }} // namespace
@@ -169,6 +169,40 @@ TEST(videoio_images, seek)
     }
 }
 
+TEST(videoio_images, read_ahead)
+{
+    const int count = 30;
+    ImageCollection col;
+    col.generate(count);
+    VideoCapture cap(col.getFirstFilename(), CAP_IMAGES, { CAP_PROP_N_THREADS, 3 });
+    ASSERT_TRUE(cap.isOpened());
+    EXPECT_EQ(3, (int)cap.get(CAP_PROP_N_THREADS));
+    Mat img;
+    for (int idx = 0; idx < count; ++idx)
+    {
+        ASSERT_TRUE(cap.read(img)) << idx;
+        EXPECT_MAT_N_DIFF(img, col.getFrame(idx), 0);
+    }
+    EXPECT_FALSE(cap.read(img));
+
+    vector<int> positions { count / 2, 0, 1, count - 1, 5, 6, 20 };
+    for (const auto &pos : positions)
+    {
+        ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, pos));
+        EXPECT_TRUE(cap.grab()); // not retrieved
+        if (pos + 1 < count)
+        {
+            EXPECT_TRUE(cap.grab());
+            EXPECT_TRUE(cap.retrieve(img));
+            EXPECT_MAT_N_DIFF(img, col.getFrame(pos + 1), 0);
+        }
+        else
+        {
+            EXPECT_FALSE(cap.grab());
+        }
+    }
+}
+
 TEST(videoio_images, pattern_overflow)
 {
     // check files: test0.png, ..., test11.png
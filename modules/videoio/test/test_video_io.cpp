@@ -4,6 +4,9 @@
 
 #include "test_precomp.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace opencv_test
 {
 
@@ -1009,4 +1012,101 @@ INSTANTIATE_TEST_CASE_P(videoio, videowriter_acceleration, testing::Combine(
         testing::ValuesIn(hw_use_umat)
 ));
 
+TEST(videoio_prefetch, read_and_seek)
+{
+    const string filename = cv::tempfile(".avi");
+    const int count = 30;
+    const Size sz(320, 240);
+    {
+        VideoWriter writer(filename, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, sz);
+        ASSERT_TRUE(writer.isOpened());
+        Mat frame(sz, CV_8UC3);
+        for (int i = 0; i < count; i++)
+        {
+            generateFrame(i, count, frame);
+            writer << frame;
+        }
+    }
+
+    std::vector<Mat> ref;
+    {
+        VideoCapture cap(filename, CAP_OPENCV_MJPEG);
+        ASSERT_TRUE(cap.isOpened());
+        Mat frame;
+        while (cap.read(frame))
+            ref.push_back(frame.clone());
+        ASSERT_EQ(count, (int)ref.size());
+    }
+
+    VideoCapture cap(filename, CAP_OPENCV_MJPEG, { CAP_PROP_PREFETCH_FRAMES, 4 });
+    ASSERT_TRUE(cap.isOpened());
+    EXPECT_EQ(CAP_OPENCV_MJPEG, (int)cap.get(CAP_PROP_BACKEND));
+    EXPECT_EQ(4, cap.get(CAP_PROP_PREFETCH_FRAMES));
+    EXPECT_EQ(0, cap.get(CAP_PROP_PREFETCH_DROP_OLDEST));
+    EXPECT_EQ(sz.width, (int)cap.get(CAP_PROP_FRAME_WIDTH));
+
+    // frames kept by the caller must not be overwritten by the recycled buffers
+    std::vector<Mat> kept;
+    Mat frame;
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(cap.read(frame));
+        EXPECT_EQ(i + 1, (int)cap.get(CAP_PROP_POS_FRAMES));
+        kept.push_back(frame);
+    }
+    for (int i = 0; i < 10; i++)
+        EXPECT_EQ(0, cvtest::norm(ref[i], kept[i], NORM_INF)) << "frame " << i;
+
+    ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, 25));
+    EXPECT_EQ(25, (int)cap.get(CAP_PROP_POS_FRAMES));
+    for (int i = 25; i < count; i++)
+    {
+        ASSERT_TRUE(cap.read(frame));
+        EXPECT_EQ(0, cvtest::norm(ref[i], frame, NORM_INF)) << "frame " << i;
+    }
+    EXPECT_FALSE(cap.read(frame));
+    EXPECT_EQ(0, cap.get(CAP_PROP_PREFETCH_DROPPED_FRAMES));
+    EXPECT_GE(cap.get(CAP_PROP_PREFETCH_LATENCY_MSEC), 0);
+
+    // rewind after the end of the stream
+    ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, 0));
+    ASSERT_TRUE(cap.read(frame));
+    EXPECT_EQ(0, cvtest::norm(ref[0], frame, NORM_INF));
+    cap.release();
+    remove(filename.c_str());
+}
+
+TEST(videoio_prefetch, drop_oldest)
+{
+    const string filename = cv::tempfile(".avi");
+    const int count = 20;
+    const Size sz(160, 120);
+    {
+        VideoWriter writer(filename, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, sz);
+        ASSERT_TRUE(writer.isOpened());
+        Mat frame(sz, CV_8UC3);
+        for (int i = 0; i < count; i++)
+        {
+            generateFrame(i, count, frame);
+            writer << frame;
+        }
+    }
+
+    VideoCapture cap(filename, CAP_OPENCV_MJPEG, { CAP_PROP_PREFETCH_FRAMES, 2, CAP_PROP_PREFETCH_DROP_OLDEST, 1 });
+    ASSERT_TRUE(cap.isOpened());
+    EXPECT_EQ(1, cap.get(CAP_PROP_PREFETCH_DROP_OLDEST));
+    // a slow consumer gets the most recent frames only
+    int numRead = 0;
+    Mat frame;
+    while (cap.read(frame))
+    {
+        numRead++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    EXPECT_LT(numRead, count);
+    EXPECT_EQ(count, numRead + (int)cap.get(CAP_PROP_PREFETCH_DROPPED_FRAMES));
+    cap.release();
+    remove(filename.c_str());
+}
+
 } // namespace